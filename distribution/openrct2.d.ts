@@ -217,8 +217,27 @@ declare global {
          * Render the current state of the map and save to disc.
          * Useful for server administration and timelapse creation.
          * @param options Options that control the capture and output file.
+         * @returns false if the capture was asynchronous and the frame was dropped, or if it was
+         *          synchronous and the file could not be written, otherwise true.
          */
-        captureImage(options: CaptureOptions): void;
+        captureImage(options: CaptureOptions): boolean;
+
+        /**
+         * Gets the statistics of the asynchronous captures since the game was started
+         * or the statistics were last reset.
+         */
+        getCaptureStatistics(): CaptureStatistics;
+
+        /**
+         * Resets the statistics returned by {@link getCaptureStatistics}. Captures that
+         * are still waiting to be written are not counted again.
+         */
+        resetCaptureStatistics(): void;
+
+        /**
+         * Waits until every asynchronous capture has been written.
+         */
+        flushCaptures(): void;
 
         /**
          * @deprecated Use {@link ObjectManager.getObject} instead.
@@ -486,8 +505,12 @@ declare global {
          */
         subscribe(hook: HookType, callback: Function): IDisposable;
 
-        subscribe(hook: "action.query", callback: (e: GameActionEventArgs) => void): IDisposable;
-        subscribe(hook: "action.execute", callback: (e: GameActionEventArgs) => void): IDisposable;
+        /**
+         * Subscribes to game actions being queried or executed. Options can limit the
+         * hook to certain actions, so the event arguments are not created for others.
+         */
+        subscribe(hook: "action.query", callback: (e: GameActionEventArgs) => void, options?: ActionHookOptions): IDisposable;
+        subscribe(hook: "action.execute", callback: (e: GameActionEventArgs) => void, options?: ActionHookOptions): IDisposable;
         subscribe(hook: "interval.tick", callback: () => void): IDisposable;
         subscribe(hook: "interval.day", callback: () => void): IDisposable;
         subscribe(hook: "network.chat", callback: (e: NetworkChatEventArgs) => void): IDisposable;
@@ -582,6 +605,70 @@ declare global {
          * Whether to enable transparency in the screenshot.
          */
         transparent?: boolean;
+
+        /**
+         * Whether to write the capture on a background thread. Only a few captures can wait
+         * to be written, if they are all still waiting the capture is dropped.
+         * Useful for capturing a frame every tick for timelapses.
+         */
+        async?: boolean;
+
+        /**
+         * The format of the output file, defaults to "png".
+         * "raw" is a 16 byte header (the magic "TRCF", the version 1, the width and the height as
+         * little endian 32 bit integers), the 256 colour palette as BGRA and then one palette index
+         * per pixel. It is quicker to write than "png".
+         */
+        format?: CaptureFormat;
+    }
+
+    type CaptureFormat = "png" | "raw";
+
+    interface CaptureStatistics {
+        /**
+         * The number of captures waiting to be written.
+         */
+        queued: number;
+
+        /**
+         * The number of captures that were rendered.
+         */
+        captured: number;
+
+        /**
+         * The number of captures that were written.
+         */
+        written: number;
+
+        /**
+         * The number of asynchronous captures that were dropped because too many were waiting to be written.
+         */
+        dropped: number;
+
+        /**
+         * The number of captures that could not be written.
+         */
+        failed: number;
+
+        /**
+         * The total size of the written files in bytes.
+         */
+        bytesWritten: number;
+
+        /**
+         * The average time taken to render a capture in milliseconds.
+         */
+        averageRenderTime: number;
+
+        /**
+         * The average time taken to encode and write a capture in milliseconds.
+         */
+        averageEncodeTime: number;
+
+        /**
+         * The number of captures written per second of encoding time.
+         */
+        encodeFramesPerSecond: number;
     }
 
     type GameMode =
@@ -1307,6 +1394,19 @@ declare global {
         height: number;
     }
 
+    interface ActionHookOptions {
+        /**
+         * The names of the actions, including custom actions, the hook is called for.
+         * The hook is called for all actions if this is not given. An empty array is an error.
+         */
+        actions?: (ActionType | string)[];
+        /**
+         * Whether to skip actions run by other actions, such as the land height
+         * changes of a smooth land operation. Defaults to false.
+         */
+        topLevelOnly?: boolean;
+    }
+
     interface GameActionEventArgs<T = object> {
         readonly player: number;
         readonly type: number;
@@ -1435,6 +1535,20 @@ declare global {
         getAllEntitiesOnTile(type: "staff", tilePos: CoordsXY): Staff[];
         getAllEntitiesOnTile(type: "car", tilePos: CoordsXY): Car[];
         getAllEntitiesOnTile(type: "litter", tilePos: CoordsXY): Litter[];
+        /**
+         * Gets the given fields of all entities of a type as typed arrays, which is much
+         * faster than reading them from the objects returned by getAllEntities.
+         * @param type The type of entities to query.
+         * @param options The fields to return and the filters to apply.
+         */
+        queryEntities(type: EntityType, options: EntityQueryOptions): EntityQueryResult;
+        /**
+         * Gets the type, heights and ride of every tile element in a range as typed arrays,
+         * without creating an object for each tile or element. Large maps can be queried
+         * a band of rows at a time.
+         * @param range The range in coordinates, clamped to the map.
+         */
+        queryTiles(range: MapRange): TileQueryResult;
         createEntity(type: EntityType, initializer: object): Entity;
 
         /**
@@ -1446,6 +1560,62 @@ declare global {
         getTrackIterator(location: CoordsXY, elementIndex: number): TrackIterator | null;
     }
 
+    /**
+     * Field names match the entity properties of the same name. All entities have
+     * "id", "x", "y" and "z". Guests and staff also have "energy", "energyTarget" and
+     * "ride". Guests also have "happiness", "happinessTarget", "nausea", "nauseaTarget",
+     * "hunger", "thirst", "toilet", "cash" and "isInPark", which is 0 or 1. Cars have
+     * "ride", "mass", "acceleration", "velocity" and "trackProgress". The ride is 65535,
+     * the same as Car.ride for a car without a ride, for guests and staff that are not
+     * queuing for or on a ride.
+     */
+    interface EntityQueryOptions {
+        fields: string[];
+        /**
+         * Only entities within this range are returned.
+         */
+        range?: MapRange;
+        /**
+         * Only entities with this ride are returned.
+         */
+        ride?: number;
+    }
+
+    /**
+     * Contains the number of entities and a typed array for each of the requested fields.
+     */
+    interface EntityQueryResult {
+        count: number;
+        [field: string]: Int32Array | number;
+    }
+
+    interface TileQueryResult {
+        /** The first tile of the range, after it has been clamped to the map. */
+        x: number;
+        y: number;
+        /** The size of the range in tiles. */
+        width: number;
+        height: number;
+        /** The total number of tile elements. */
+        count: number;
+        /**
+         * The index of the first element of each tile, row by row. The elements of the
+         * tile at (x + i, y + j) are from offsets[j * width + i] up to, but not including,
+         * offsets[j * width + i + 1].
+         */
+        offsets: Uint32Array;
+        /**
+         * The type of each element: 0 surface, 1 footpath, 2 track, 3 small_scenery,
+         * 4 entrance, 5 wall, 6 large_scenery, 7 banner.
+         */
+        type: Uint8Array;
+        baseHeight: Uint8Array;
+        clearanceHeight: Uint8Array;
+        /** The ride of track, entrance and queue elements, -1 for all other elements. */
+        ride: Int16Array;
+        isGhost: Uint8Array;
+    }
+
     type TileElementType =
         "surface" | "footpath" | "track" | "small_scenery" | "wall" | "entrance" | "large_scenery" | "banner";
 
@@ -1590,7 +1760,10 @@ declare global {
         readonly x: number;
         /** The y position in tiles. */
         readonly y: number;
-        /** Gets an array of all the tile elements on this tile. */
+        /**
+         * Gets an array of all the tile elements on this tile. Each element is only
+         * created when it is first read from the array.
+         */
         readonly elements: TileElement[];
         /** Gets the number of tile elements on this tile. */
         readonly numElements: number;
@@ -4707,6 +4880,34 @@ declare global {
         stop(): void;
         reset(): void;
         readonly enabled: boolean;
+
+        /**
+         * Starts recording a timeline of every profiled function call for the
+         * given number of ticks, or until stopTrace is called when 0.
+         */
+        startTrace(ticks: number): void;
+        stopTrace(): void;
+        /**
+         * Gets the last recorded timeline as Chrome trace event JSON, which can
+         * be opened in chrome://tracing or ui.perfetto.dev.
+         */
+        getTrace(): string;
+        readonly tracing: boolean;
+
+        /**
+         * Gets the memory owned by each subsystem. Allocation counts are only
+         * collected while memory tracking is enabled.
+         */
+        getMemoryData(): ProfiledMemory[];
+        startMemory(): void;
+        stopMemory(): void;
+        readonly memoryEnabled: boolean;
+
+        /**
+         * Gets the time each plug-in has spent in its hooks, intervals and custom
+         * actions. These are always collected and are cleared by reset.
+         */
+        getPluginData(): ProfiledPlugin[];
     }
 
     interface ProfiledFunction {
@@ -4719,6 +4920,33 @@ declare global {
         readonly children: number[];
     }
 
+    interface ProfiledPlugin {
+        readonly name: string;
+        readonly calls: ProfiledPluginCall[];
+    }
+
+    interface ProfiledPluginCall {
+        /**
+         * The hook, "interval", "action.custom.query" or "action.custom.execute".
+         */
+        readonly name: string;
+        readonly callCount: number;
+        readonly maxTime: number;
+        readonly totalTime: number;
+    }
+
+    interface ProfiledMemory {
+        readonly name: string;
+        readonly currentBytes: number;
+        readonly peakBytes: number;
+        readonly allocationCount: number;
+        /**
+         * The number of allocations and bytes allocated during the last tick.
+         */
+        readonly tickAllocationCount: number;
+        readonly tickAllocatedBytes: number;
+    }
+
     interface ObjectManager {
         /**
          * Gets all the objects that are installed and can be loaded into the park.
@@ -442,6 +442,10 @@ public:
                 WindowGuestListRefreshList();
                 break;
 
+            case INTENT_ACTION_UPDATE_GUEST_LIST:
+                WindowGuestListUpdateList();
+                break;
+
             case INTENT_ACTION_REFRESH_STAFF_LIST:
             {
                 WindowStaffListRefresh();
@@ -478,7 +482,7 @@ public:
                 gToolbarDirtyFlags |= BTM_TB_DIRTY_FLAG_PEEP_COUNT;
                 WindowInvalidateByClass(WindowClass::GuestList);
                 WindowInvalidateByClass(WindowClass::ParkInformation);
-                WindowGuestListRefreshList();
+                WindowGuestListUpdateList();
                 break;
 
             case INTENT_ACTION_UPDATE_PARK_RATING:
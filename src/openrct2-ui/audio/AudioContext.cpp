@@ -107,13 +107,17 @@ namespace OpenRCT2::Audio
             {
                 auto source = CreateAudioSource(rw);
 
-                // Load whole stream into memory if small enough
+                // Load whole stream into memory if small enough, otherwise decode it ahead of the mixer
                 auto dataLength = source->GetLength();
                 if (dataLength < STREAM_MIN_SIZE)
                 {
                     auto& targetFormat = _audioMixer->GetFormat();
                     source = source->ToMemory(targetFormat);
                 }
+                else
+                {
+                    source = CreateStreamingAudioSource(std::move(source));
+                }
 
                 return AddSource(std::move(source));
             }
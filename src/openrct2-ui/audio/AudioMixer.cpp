@@ -57,6 +57,8 @@ void AudioMixer::Close()
     SDL_CloseAudioDevice(_deviceId);
 
     // Free buffers
+    _mixBuffer.clear();
+    _mixBuffer.shrink_to_fit();
     _channelBuffer.clear();
     _channelBuffer.shrink_to_fit();
     _convertBuffer.clear();
@@ -128,8 +130,10 @@ void AudioMixer::GetNextAudioChunk(uint8_t* dst, size_t length)
 {
     UpdateAdjustedSound();
 
-    // Zero the output buffer
-    std::fill_n(dst, length, 0);
+    // The output is always 16-bit as the device is opened without allowing any changes to the format
+    const auto numSamples = length / sizeof(int16_t);
+    _mixBuffer.resize(numSamples);
+    std::fill(_mixBuffer.begin(), _mixBuffer.end(), 0.0f);
 
     // Mix channels onto output buffer
     auto it = _channels.begin();
@@ -149,11 +153,13 @@ void AudioMixer::GetNextAudioChunk(uint8_t* dst, size_t length)
             if ((group != MixerGroup::Sound || gConfigSound.SoundEnabled) && gConfigSound.MasterSoundEnabled
                 && gConfigSound.MasterVolume != 0)
             {
-                MixChannel(channel.get(), dst, length);
+                MixChannel(channel.get(), length);
             }
             it++;
         }
     }
+
+    ConvertMixToS16(reinterpret_cast<int16_t*>(dst), _mixBuffer.data(), numSamples);
 }
 
 void AudioMixer::UpdateAdjustedSound()
@@ -171,7 +177,7 @@ void AudioMixer::UpdateAdjustedSound()
     }
 }
 
-void AudioMixer::MixChannel(ISDLAudioChannel* channel, uint8_t* data, size_t length)
+void AudioMixer::MixChannel(ISDLAudioChannel* channel, size_t length)
 {
     int32_t byteRate = _format.GetByteRate();
     auto numSamples = static_cast<int32_t>(length / byteRate);
@@ -240,13 +246,9 @@ void AudioMixer::MixChannel(ISDLAudioChannel* channel, uint8_t* data, size_t len
         buffer = _effectBuffer.data();
     }
 
-    // Apply panning and volume
-    ApplyPan(channel, buffer, bufferLen, byteRate);
-    int32_t mixVolume = ApplyVolume(channel, buffer, bufferLen);
-
-    // Finally mix on to destination buffer
-    size_t dstLength = std::min(length, bufferLen);
-    SDL_MixAudioFormat(data, static_cast<const uint8_t*>(buffer), _format.format, static_cast<uint32_t>(dstLength), mixVolume);
+    // Apply volume and panning while adding the channel to the mix
+    size_t numFrames = std::min(length, bufferLen) / byteRate;
+    MixS16(_mixBuffer.data(), static_cast<const int16_t*>(buffer), numFrames, _format.channels, GetMixGain(channel));
 
     channel->UpdateOldVolume();
 }
@@ -278,23 +280,11 @@ size_t AudioMixer::ApplyResample(
     return outLen * byteRate;
 }
 
-void AudioMixer::ApplyPan(const IAudioChannel* channel, void* buffer, size_t len, size_t sampleSize)
-{
-    if (channel->GetPan() != 0.5f && _format.channels == 2)
-    {
-        switch (_format.format)
-        {
-            case AUDIO_S16SYS:
-                EffectPanS16(channel, static_cast<int16_t*>(buffer), static_cast<int32_t>(len / sampleSize));
-                break;
-            case AUDIO_U8:
-                EffectPanU8(channel, static_cast<uint8_t*>(buffer), static_cast<int32_t>(len / sampleSize));
-                break;
-        }
-    }
-}
-
-int32_t AudioMixer::ApplyVolume(const IAudioChannel* channel, void* buffer, size_t len)
+/**
+ * Gets the gain to fade from the previous volume and pan of the channel to the current ones over the next buffer,
+ * which avoids clicks from sudden changes.
+ */
+MixGain AudioMixer::GetMixGain(const IAudioChannel* channel) const
 {
     float volumeAdjust = _volume;
     volumeAdjust *= gConfigSound.MasterSoundEnabled ? (static_cast<float>(gConfigSound.MasterVolume) / 100.0f) : 0.0f;
@@ -323,83 +313,10 @@ int32_t AudioMixer::ApplyVolume(const IAudioChannel* channel, void* buffer, size
         endVolume = 0;
     }
 
-    int32_t mixVolume = channel->GetVolume() * volumeAdjust;
-    if (startVolume != endVolume)
-    {
-        // Set to max since we are adjusting the volume ourselves
-        mixVolume = MIXER_VOLUME_MAX;
-
-        // Fade between volume levels to smooth out sound and minimize clicks from sudden volume changes
-        int32_t fadeLength = static_cast<int32_t>(len) / _format.BytesPerSample();
-        switch (_format.format)
-        {
-            case AUDIO_S16SYS:
-                EffectFadeS16(static_cast<int16_t*>(buffer), fadeLength, startVolume, endVolume);
-                break;
-            case AUDIO_U8:
-                EffectFadeU8(static_cast<uint8_t*>(buffer), fadeLength, startVolume, endVolume);
-                break;
-        }
-    }
-    return mixVolume;
-}
-
-void AudioMixer::EffectPanS16(const IAudioChannel* channel, int16_t* data, int32_t length)
-{
-    const float dt = 1.0f / static_cast<float>(length * 2.0f);
-    float volumeL = channel->GetOldVolumeL();
-    float volumeR = channel->GetOldVolumeR();
-    const float d_left = dt * (channel->GetVolumeL() - channel->GetOldVolumeL());
-    const float d_right = dt * (channel->GetVolumeR() - channel->GetOldVolumeR());
-
-    for (int32_t i = 0; i < length * 2; i += 2)
-    {
-        data[i + 0] = static_cast<int16_t>(volumeL * static_cast<float>(data[i + 0]));
-        data[i + 1] = static_cast<int16_t>(volumeR * static_cast<float>(data[i + 1]));
-        volumeL += d_left;
-        volumeR += d_right;
-    }
-}
-
-void AudioMixer::EffectPanU8(const IAudioChannel* channel, uint8_t* data, int32_t length)
-{
-    float volumeL = channel->GetVolumeL();
-    float volumeR = channel->GetVolumeR();
-    float oldVolumeL = channel->GetOldVolumeL();
-    float oldVolumeR = channel->GetOldVolumeR();
-
-    for (int32_t i = 0; i < length * 2; i += 2)
-    {
-        float t = static_cast<float>(i) / static_cast<float>(length * 2.0f);
-        data[i] = static_cast<uint8_t>(data[i] * ((1.0 - t) * oldVolumeL + t * volumeL));
-        data[i + 1] = static_cast<uint8_t>(data[i + 1] * ((1.0 - t) * oldVolumeR + t * volumeR));
-    }
-}
-
-void AudioMixer::EffectFadeS16(int16_t* data, int32_t length, int32_t startvolume, int32_t endvolume)
-{
-    static_assert(SDL_MIX_MAXVOLUME == MIXER_VOLUME_MAX, "Max volume differs between OpenRCT2 and SDL2");
-
-    float startvolume_f = static_cast<float>(startvolume) / SDL_MIX_MAXVOLUME;
-    float endvolume_f = static_cast<float>(endvolume) / SDL_MIX_MAXVOLUME;
-    for (int32_t i = 0; i < length; i++)
-    {
-        float t = static_cast<float>(i) / length;
-        data[i] = static_cast<int16_t>(data[i] * ((1.0f - t) * startvolume_f + t * endvolume_f));
-    }
-}
-
-void AudioMixer::EffectFadeU8(uint8_t* data, int32_t length, int32_t startvolume, int32_t endvolume)
-{
-    static_assert(SDL_MIX_MAXVOLUME == MIXER_VOLUME_MAX, "Max volume differs between OpenRCT2 and SDL2");
-
-    float startvolume_f = static_cast<float>(startvolume) / SDL_MIX_MAXVOLUME;
-    float endvolume_f = static_cast<float>(endvolume) / SDL_MIX_MAXVOLUME;
-    for (int32_t i = 0; i < length; i++)
-    {
-        float t = static_cast<float>(i) / length;
-        data[i] = static_cast<uint8_t>(data[i] * ((1.0f - t) * startvolume_f + t * endvolume_f));
-    }
+    const auto startGain = static_cast<float>(startVolume) / MIXER_VOLUME_MAX;
+    const auto endGain = static_cast<float>(endVolume) / MIXER_VOLUME_MAX;
+    return MixGain{ channel->GetOldVolumeL() * startGain, channel->GetOldVolumeR() * startGain,
+                    channel->GetVolumeL() * endGain, channel->GetVolumeR() * endGain };
 }
 
 bool AudioMixer::Convert(SDL_AudioCVT* cvt, const void* src, size_t len)
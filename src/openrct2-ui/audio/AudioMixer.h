@@ -21,6 +21,7 @@
 #include <openrct2/Context.h>
 #include <openrct2/audio/AudioChannel.h>
 #include <openrct2/audio/AudioMixer.h>
+#include <openrct2/audio/AudioMixing.h>
 #include <openrct2/audio/AudioSource.h>
 #include <openrct2/audio/audio.h>
 #include <vector>
@@ -41,6 +42,8 @@ namespace OpenRCT2::Audio
         uint8_t _settingSoundVolume = 0xFF;
         uint8_t _settingMusicVolume = 0xFF;
 
+        // Every channel is added to this buffer before it is converted to the output format once.
+        std::vector<float> _mixBuffer;
         std::vector<uint8_t> _channelBuffer;
         std::vector<uint8_t> _convertBuffer;
         std::vector<uint8_t> _effectBuffer;
@@ -62,7 +65,7 @@ namespace OpenRCT2::Audio
     private:
         void GetNextAudioChunk(uint8_t* dst, size_t length);
         void UpdateAdjustedSound();
-        void MixChannel(ISDLAudioChannel* channel, uint8_t* data, size_t length);
+        void MixChannel(ISDLAudioChannel* channel, size_t length);
         void RemoveReleasedSources();
 
         /**
@@ -72,12 +75,7 @@ namespace OpenRCT2::Audio
         size_t ApplyResample(
             ISDLAudioChannel* channel, const void* srcBuffer, int32_t srcSamples, int32_t dstSamples, int32_t inRate,
             int32_t outRate);
-        void ApplyPan(const IAudioChannel* channel, void* buffer, size_t len, size_t sampleSize);
-        int32_t ApplyVolume(const IAudioChannel* channel, void* buffer, size_t len);
-        static void EffectPanS16(const IAudioChannel* channel, int16_t* data, int32_t length);
-        static void EffectPanU8(const IAudioChannel* channel, uint8_t* data, int32_t length);
-        static void EffectFadeS16(int16_t* data, int32_t length, int32_t startvolume, int32_t endvolume);
-        static void EffectFadeU8(uint8_t* data, int32_t length, int32_t startvolume, int32_t endvolume);
+        MixGain GetMixGain(const IAudioChannel* channel) const;
         bool Convert(SDL_AudioCVT* cvt, const void* src, size_t len);
     };
 } // namespace OpenRCT2::Audio
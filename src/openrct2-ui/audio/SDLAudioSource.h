@@ -55,5 +55,6 @@ namespace OpenRCT2::Audio
         const AudioFormat& target, const AudioFormat& src, std::vector<uint8_t>&& pcmData);
     std::unique_ptr<SDLAudioSource> CreateFlacAudioSource(SDL_RWops* rw);
     std::unique_ptr<SDLAudioSource> CreateOggAudioSource(SDL_RWops* rw);
+    std::unique_ptr<SDLAudioSource> CreateStreamingAudioSource(std::unique_ptr<SDLAudioSource> source);
     std::unique_ptr<SDLAudioSource> CreateWavAudioSource(SDL_RWops* rw);
 } // namespace OpenRCT2::Audio
@@ -0,0 +1,264 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "SDLAudioSource.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace OpenRCT2::Audio
+{
+    class StreamingAudioSource;
+
+    /**
+     * Decodes every streaming audio source ahead of the mixer on a single background thread.
+     */
+    class AudioStreamDecoder
+    {
+    private:
+        // How long the thread waits before checking the sources again when all their buffers are full.
+        static constexpr auto IdleInterval = std::chrono::milliseconds(5);
+
+        std::mutex _mutex;
+        std::condition_variable _wake;
+        std::condition_variable _decodeFinished;
+        std::vector<StreamingAudioSource*> _sources;
+        // The source that is being decoded, without holding the lock so that other sources can be added and removed.
+        StreamingAudioSource* _decoding{};
+        std::thread _thread;
+        bool _stop{};
+
+    public:
+        ~AudioStreamDecoder()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stop = true;
+            }
+            _wake.notify_one();
+            if (_thread.joinable())
+            {
+                _thread.join();
+            }
+        }
+
+        void Add(StreamingAudioSource* source)
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _sources.push_back(source);
+                if (!_thread.joinable())
+                {
+                    _thread = std::thread([this]() { Run(); });
+                }
+            }
+            _wake.notify_one();
+        }
+
+        // Waits for the source to no longer be decoded so it can be freed.
+        void Remove(StreamingAudioSource* source)
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _sources.erase(std::remove(_sources.begin(), _sources.end(), source), _sources.end());
+            _decodeFinished.wait(lock, [this, source]() { return _decoding != source; });
+        }
+
+    private:
+        void Run();
+    };
+
+    static AudioStreamDecoder& GetStreamDecoder()
+    {
+        static AudioStreamDecoder decoder;
+        return decoder;
+    }
+
+    /**
+     * An audio source which is decoded ahead on a background thread into a ring buffer, so the mixer
+     * only has to copy the decoded data. Reads that do not continue where the last read ended, such
+     * as seeks and loops, are decoded straight away and restart the decoding from there.
+     */
+    class StreamingAudioSource final : public SDLAudioSource
+    {
+    private:
+        // Size of each block decoded by the background thread.
+        static constexpr size_t DecodeBlockSize = 16 * 1024;
+
+        std::unique_ptr<SDLAudioSource> _source;
+        AudioFormat _format{};
+        uint64_t _length{};
+
+        // Held while the source is being decoded, by the background thread or by a read that missed the buffer.
+        std::mutex _decodeMutex;
+        uint64_t _decodeOffset{};
+        std::vector<uint8_t> _decodeBuffer;
+
+        // Single producer, single consumer ring buffer. _head is only written by the background thread, _tail and
+        // _readOffset are only written by the mixer.
+        std::vector<uint8_t> _buffer;
+        size_t _bufferMask{};
+        std::atomic<size_t> _head{};
+        std::atomic<size_t> _tail{};
+        uint64_t _readOffset{};
+
+    public:
+        StreamingAudioSource(std::unique_ptr<SDLAudioSource> source)
+            : _source(std::move(source))
+            , _format(_source->GetFormat())
+            , _length(_source->GetLength())
+            , _decodeBuffer(DecodeBlockSize)
+        {
+            // About a second of audio, which is many times the length of each mixer callback
+            size_t bufferSize = DecodeBlockSize;
+            while (bufferSize < static_cast<size_t>(_format.GetBytesPerSecond()))
+            {
+                bufferSize *= 2;
+            }
+            _buffer.resize(bufferSize);
+            _bufferMask = bufferSize - 1;
+
+            GetStreamDecoder().Add(this);
+        }
+
+        ~StreamingAudioSource() override
+        {
+            Release();
+        }
+
+        [[nodiscard]] uint64_t GetLength() const override
+        {
+            return _length;
+        }
+
+        [[nodiscard]] AudioFormat GetFormat() const override
+        {
+            return _format;
+        }
+
+        size_t Read(void* dst, uint64_t offset, size_t len) override
+        {
+            if (offset == _readOffset)
+            {
+                const auto tail = _tail.load(std::memory_order_relaxed);
+                const auto available = _head.load(std::memory_order_acquire) - tail;
+                if (available != 0)
+                {
+                    const auto readLen = std::min(len, available);
+                    CopyFromBuffer(static_cast<uint8_t*>(dst), tail, readLen);
+                    _tail.store(tail + readLen, std::memory_order_release);
+                    _readOffset += readLen;
+                    return readLen;
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(_decodeMutex);
+            if (_source == nullptr)
+                return 0;
+
+            // The background thread is not decoding while the lock is held, so the buffer can be emptied
+            const auto readLen = _source->Read(dst, offset, len);
+            _tail.store(_head.load(std::memory_order_relaxed), std::memory_order_release);
+            _readOffset = offset + readLen;
+            _decodeOffset = _readOffset;
+            return readLen;
+        }
+
+        // Decodes one block if there is room for it, returns false if there was nothing to do.
+        bool DecodeAhead()
+        {
+            std::unique_lock<std::mutex> lock(_decodeMutex, std::try_to_lock);
+            if (!lock.owns_lock() || _source == nullptr || _decodeOffset >= _length)
+                return false;
+
+            const auto head = _head.load(std::memory_order_relaxed);
+            const auto space = _buffer.size() - (head - _tail.load(std::memory_order_acquire));
+            if (space < DecodeBlockSize)
+                return false;
+
+            const auto decodedLen = _source->Read(_decodeBuffer.data(), _decodeOffset, DecodeBlockSize);
+            if (decodedLen == 0)
+            {
+                // Nothing more can be read, stop decoding until the mixer reads from somewhere else
+                _decodeOffset = _length;
+                return false;
+            }
+
+            CopyToBuffer(_decodeBuffer.data(), head, decodedLen);
+            _head.store(head + decodedLen, std::memory_order_release);
+            _decodeOffset += decodedLen;
+            return true;
+        }
+
+    protected:
+        void Unload() override
+        {
+            GetStreamDecoder().Remove(this);
+
+            std::lock_guard<std::mutex> lock(_decodeMutex);
+            _source = nullptr;
+            _buffer.clear();
+            _buffer.shrink_to_fit();
+        }
+
+    private:
+        void CopyFromBuffer(uint8_t* dst, size_t position, size_t len) const
+        {
+            const auto start = position & _bufferMask;
+            const auto firstLen = std::min(len, _buffer.size() - start);
+            std::copy_n(_buffer.data() + start, firstLen, dst);
+            std::copy_n(_buffer.data(), len - firstLen, dst + firstLen);
+        }
+
+        void CopyToBuffer(const uint8_t* src, size_t position, size_t len)
+        {
+            const auto start = position & _bufferMask;
+            const auto firstLen = std::min(len, _buffer.size() - start);
+            std::copy_n(src, firstLen, _buffer.data() + start);
+            std::copy_n(src + firstLen, len - firstLen, _buffer.data());
+        }
+    };
+
+    void AudioStreamDecoder::Run()
+    {
+        std::vector<StreamingAudioSource*> sources;
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (!_stop)
+        {
+            bool decoded = false;
+            sources = _sources;
+            for (auto* source : sources)
+            {
+                // Skip sources that were removed while another source was decoded
+                if (std::find(_sources.begin(), _sources.end(), source) == _sources.end())
+                    continue;
+
+                _decoding = source;
+                lock.unlock();
+                decoded |= source->DecodeAhead();
+                lock.lock();
+                _decoding = nullptr;
+                _decodeFinished.notify_all();
+            }
+            if (!decoded)
+            {
+                _wake.wait_for(lock, IdleInterval);
+            }
+        }
+    }
+
+    std::unique_ptr<SDLAudioSource> CreateStreamingAudioSource(std::unique_ptr<SDLAudioSource> source)
+    {
+        return std::make_unique<StreamingAudioSource>(std::move(source));
+    }
+} // namespace OpenRCT2::Audio
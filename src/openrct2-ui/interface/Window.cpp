@@ -820,3 +820,16 @@ ScreenCoordsXY WindowGetViewportSoundIconPos(WindowBase& w)
     const uint8_t buttonOffset = (gConfigInterface.WindowButtonsOnTheLeft) ? CloseButtonWidth + 2 : 0;
     return w.windowPos + ScreenCoordsXY{ 2 + buttonOffset, 2 };
 }
+
+/**
+ * Gets the rows of a list with a fixed row height that intersect the scroll view being drawn, so that lists only need
+ * to draw the rows on screen rather than every item. A one pixel margin is included for text drawn just above its row.
+ */
+ScrollRowRange WindowGetVisibleScrollRows(const DrawPixelInfo& dpi, int32_t rowHeight, size_t numRows)
+{
+    const auto top = std::max(0, dpi.y - 1);
+    const auto bottom = std::max(0, dpi.y + dpi.height + 1);
+    const auto first = std::min(static_cast<size_t>(top / rowHeight), numRows);
+    const auto last = std::min(static_cast<size_t>((bottom + rowHeight - 1) / rowHeight), numRows);
+    return { first, last };
+}
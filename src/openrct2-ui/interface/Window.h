@@ -36,7 +36,17 @@ struct Window : WindowBase
         uintptr_t existingArgs, int32_t maxLength);
 };
 
+/**
+ * Range of rows [First, Last) of a scrollable list that are visible within a scroll view.
+ */
+struct ScrollRowRange
+{
+    size_t First{};
+    size_t Last{};
+};
+
 void WindowAllWheelInput();
 void ApplyScreenSaverLockSetting();
 void WindowAlignTabs(WindowBase* w, WidgetIndex start_tab_id, WidgetIndex end_tab_id);
 ScreenCoordsXY WindowGetViewportSoundIconPos(WindowBase& w);
+ScrollRowRange WindowGetVisibleScrollRows(const DrawPixelInfo& dpi, int32_t rowHeight, size_t numRows);
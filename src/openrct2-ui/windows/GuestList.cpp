@@ -123,9 +123,17 @@ private:
         using CompareFunc = bool (*)(const GuestItem&, const GuestItem&);
 
         EntityId Id;
+        uint32_t PeepId;
         char Name[256];
     };
 
+    enum class ListUpdate : uint8_t
+    {
+        None,
+        Incremental,
+        Full,
+    };
+
     static constexpr uint8_t SUMMARISED_GUEST_ROW_HEIGHT = SCROLLABLE_ROW_HEIGHT + 11;
     static constexpr auto GUESTS_PER_PAGE = 2000;
     static constexpr const auto GUEST_PAGE_HEIGHT = GUESTS_PER_PAGE * SCROLLABLE_ROW_HEIGHT;
@@ -147,6 +155,8 @@ private:
     std::vector<GuestGroup> _groups;
 
     std::vector<GuestItem> _guestList;
+    std::vector<bool> _guestListed;
+    ListUpdate _pendingListUpdate{};
     std::optional<size_t> _highlightedIndex;
 
     uint32_t _tabAnimationIndex{};
@@ -273,6 +283,21 @@ public:
         InvalidateWidget(WIDX_TAB_1 + static_cast<int32_t>(_selectedTab));
 
         gWindowMapFlashingFlags |= MapFlashingFlags::GuestListOpen;
+
+        // Apply all list changes requested since the last update at once
+        switch (_pendingListUpdate)
+        {
+            case ListUpdate::None:
+                break;
+            case ListUpdate::Incremental:
+                UpdateList();
+                Invalidate();
+                break;
+            case ListUpdate::Full:
+                RefreshList();
+                Invalidate();
+                break;
+        }
     }
 
     void OnMouseUp(WidgetIndex widgetIndex) override
@@ -555,18 +580,13 @@ public:
             {
                 auto i = screenCoords.y / SCROLLABLE_ROW_HEIGHT;
                 i += static_cast<int32_t>(_selectedPage * GUESTS_PER_PAGE);
-                for (const auto& guestItem : _guestList)
+                if (i >= 0 && static_cast<size_t>(i) < _guestList.size())
                 {
-                    if (i == 0)
+                    auto guest = GetEntity<Guest>(_guestList[i].Id);
+                    if (guest != nullptr)
                     {
-                        auto guest = GetEntity<Guest>(guestItem.Id);
-                        if (guest != nullptr)
-                        {
-                            WindowGuestOpen(guest);
-                        }
-                        break;
+                        WindowGuestOpen(guest);
                     }
-                    i--;
                 }
                 break;
             }
@@ -607,6 +627,8 @@ public:
 
     void RefreshList()
     {
+        _pendingListUpdate = ListUpdate::None;
+
         // Only the individual tab uses the GuestList so no point calculating it
         if (_selectedTab != TabId::Individual)
         {
@@ -618,28 +640,63 @@ public:
 
             for (auto peep : EntityList<Guest>())
             {
-                EntitySetFlashing(peep, false);
-                if (peep->OutsideOfPark)
-                    continue;
-                if (_selectedFilter)
-                {
-                    if (!IsPeepInFilter(*peep))
-                        continue;
-                    EntitySetFlashing(peep, true);
-                }
-                if (!GuestShouldBeVisible(*peep))
-                    continue;
+                TryAddGuest(*peep);
+            }
+
+            std::sort(_guestList.begin(), _guestList.end(), GetGuestCompareFunc());
+        }
+    }
+
+    /**
+     * Brings the guest list up to date after guests have entered or left the park. Guests that remain in the list keep
+     * their formatted name and sorted position, only the new guests are formatted, sorted and merged in.
+     */
+    void UpdateList()
+    {
+        _pendingListUpdate = ListUpdate::None;
 
-                auto& item = _guestList.emplace_back();
-                item.Id = peep->Id;
+        // The summarised tab refreshes its groups periodically by itself
+        if (_selectedTab != TabId::Individual)
+            return;
 
-                Formatter ft;
-                peep->FormatNameTo(ft);
-                OpenRCT2::FormatStringLegacy(item.Name, sizeof(item.Name), STR_STRINGID, ft.Data());
+        _guestListed.assign(MAX_ENTITIES, false);
+        auto newEnd = std::remove_if(_guestList.begin(), _guestList.end(), [this](const GuestItem& item) {
+            auto* peep = GetEntity<Guest>(item.Id);
+            if (peep == nullptr || peep->PeepId != item.PeepId)
+                return true;
+            if (!IsGuestStillListed(*peep, item))
+            {
+                EntitySetFlashing(peep, false);
+                return true;
             }
+            _guestListed[item.Id.ToUnderlying()] = true;
+            return false;
+        });
+        _guestList.erase(newEnd, _guestList.end());
 
-            std::sort(_guestList.begin(), _guestList.end(), GetGuestCompareFunc());
+        const auto numKept = static_cast<std::ptrdiff_t>(_guestList.size());
+        for (auto peep : EntityList<Guest>())
+        {
+            if (!_guestListed[peep->Id.ToUnderlying()])
+            {
+                TryAddGuest(*peep);
+            }
         }
+
+        auto compareFunc = GetGuestCompareFunc();
+        std::sort(_guestList.begin() + numKept, _guestList.end(), compareFunc);
+        std::inplace_merge(_guestList.begin(), _guestList.begin() + numKept, _guestList.end(), compareFunc);
+    }
+
+    /**
+     * Defers updating the list to the next window update so that several changes within a tick only cause one update.
+     */
+    void RequestListUpdate(bool full)
+    {
+        if (full)
+            _pendingListUpdate = ListUpdate::Full;
+        else if (_pendingListUpdate == ListUpdate::None)
+            _pendingListUpdate = ListUpdate::Incremental;
     }
 
 private:
@@ -661,68 +718,67 @@ private:
 
     void DrawScrollIndividual(DrawPixelInfo& dpi)
     {
-        size_t index = 0;
-        auto y = static_cast<int32_t>(_selectedPage) * -GUEST_PAGE_HEIGHT;
-        for (const auto& guestItem : _guestList)
+        // Only the rows of the current page that are within the scroll view are drawn
+        const auto pageStart = std::min(_selectedPage * GUESTS_PER_PAGE, _guestList.size());
+        const auto pageSize = std::min<size_t>(_guestList.size() - pageStart, GUESTS_PER_PAGE);
+        const auto visibleRows = WindowGetVisibleScrollRows(dpi, SCROLLABLE_ROW_HEIGHT, pageSize);
+        for (auto row = visibleRows.First; row < visibleRows.Last; row++)
         {
-            // Check if y is beyond the scroll control
-            if (y + SCROLLABLE_ROW_HEIGHT + 1 >= -0x7FFF && y + SCROLLABLE_ROW_HEIGHT + 1 > dpi.y && y < 0x7FFF
-                && y < dpi.y + dpi.height)
-            {
-                // Highlight backcolour and text colour (format)
-                StringId format = STR_BLACK_STRING;
-                if (index == _highlightedIndex)
-                {
-                    GfxFilterRect(dpi, { 0, y, 800, y + SCROLLABLE_ROW_HEIGHT - 1 }, FilterPaletteID::PaletteDarken1);
-                    format = STR_WINDOW_COLOUR_2_STRINGID;
-                }
+            const auto index = pageStart + row;
+            const auto& guestItem = _guestList[index];
+            const auto y = static_cast<int32_t>(row) * SCROLLABLE_ROW_HEIGHT;
 
-                // Guest name
-                auto peep = GetEntity<Guest>(guestItem.Id);
-                if (peep == nullptr)
-                {
-                    continue;
-                }
-                auto ft = Formatter();
-                peep->FormatNameTo(ft);
-                DrawTextEllipsised(dpi, { 0, y }, 113, format, ft);
+            // Highlight backcolour and text colour (format)
+            StringId format = STR_BLACK_STRING;
+            if (index == _highlightedIndex)
+            {
+                GfxFilterRect(dpi, { 0, y, 800, y + SCROLLABLE_ROW_HEIGHT - 1 }, FilterPaletteID::PaletteDarken1);
+                format = STR_WINDOW_COLOUR_2_STRINGID;
+            }
 
-                switch (_selectedView)
-                {
-                    case GuestViewType::Actions:
-                        // Guest face
-                        GfxDrawSprite(dpi, ImageId(GetPeepFaceSpriteSmall(peep)), { 118, y + 1 });
+            // Guest name
+            auto peep = GetEntity<Guest>(guestItem.Id);
+            if (peep == nullptr)
+            {
+                continue;
+            }
+            auto ft = Formatter();
+            peep->FormatNameTo(ft);
+            DrawTextEllipsised(dpi, { 0, y }, 113, format, ft);
 
-                        // Tracking icon
-                        if (peep->PeepFlags & PEEP_FLAGS_TRACKING)
-                            GfxDrawSprite(dpi, ImageId(STR_ENTER_SELECTION_SIZE), { 112, y + 1 });
+            switch (_selectedView)
+            {
+                case GuestViewType::Actions:
+                    // Guest face
+                    GfxDrawSprite(dpi, ImageId(GetPeepFaceSpriteSmall(peep)), { 118, y + 1 });
+
+                    // Tracking icon
+                    if (peep->PeepFlags & PEEP_FLAGS_TRACKING)
+                        GfxDrawSprite(dpi, ImageId(STR_ENTER_SELECTION_SIZE), { 112, y + 1 });
+
+                    // Action
+                    ft = Formatter();
+                    peep->FormatActionTo(ft);
+                    DrawTextEllipsised(dpi, { 133, y }, 314, format, ft);
+                    break;
+                case GuestViewType::Thoughts:
+                    // For each thought
+                    for (const auto& thought : peep->Thoughts)
+                    {
+                        if (thought.type == PeepThoughtType::None)
+                            break;
+                        if (thought.freshness == 0)
+                            continue;
+                        if (thought.freshness > 5)
+                            break;
 
-                        // Action
                         ft = Formatter();
-                        peep->FormatActionTo(ft);
-                        DrawTextEllipsised(dpi, { 133, y }, 314, format, ft);
+                        PeepThoughtSetFormatArgs(&thought, ft);
+                        DrawTextEllipsised(dpi, { 118, y }, 329, format, ft, { FontStyle::Small });
                         break;
-                    case GuestViewType::Thoughts:
-                        // For each thought
-                        for (const auto& thought : peep->Thoughts)
-                        {
-                            if (thought.type == PeepThoughtType::None)
-                                break;
-                            if (thought.freshness == 0)
-                                continue;
-                            if (thought.freshness > 5)
-                                break;
-
-                            ft = Formatter();
-                            PeepThoughtSetFormatArgs(&thought, ft);
-                            DrawTextEllipsised(dpi, { 118, y }, 329, format, ft, { FontStyle::Small });
-                            break;
-                        }
-                        break;
-                }
+                    }
+                    break;
             }
-            y += SCROLLABLE_ROW_HEIGHT;
-            index++;
         }
     }
 
@@ -778,6 +834,45 @@ private:
         }
     }
 
+    void TryAddGuest(Guest& peep)
+    {
+        EntitySetFlashing(&peep, false);
+        if (peep.OutsideOfPark)
+            return;
+        if (_selectedFilter)
+        {
+            if (!IsPeepInFilter(peep))
+                return;
+            EntitySetFlashing(&peep, true);
+        }
+        if (!GuestShouldBeVisible(peep))
+            return;
+
+        auto& item = _guestList.emplace_back();
+        item.Id = peep.Id;
+        item.PeepId = peep.PeepId;
+
+        Formatter ft;
+        peep.FormatNameTo(ft);
+        OpenRCT2::FormatStringLegacy(item.Name, sizeof(item.Name), STR_STRINGID, ft.Data());
+    }
+
+    /**
+     * Same conditions as TryAddGuest but uses the name already formatted for the list item.
+     */
+    bool IsGuestStillListed(const Guest& peep, const GuestItem& item)
+    {
+        if (peep.OutsideOfPark)
+            return false;
+        if (_selectedFilter && !IsPeepInFilter(peep))
+            return false;
+        if (_trackingOnly && !(peep.PeepFlags & PEEP_FLAGS_TRACKING))
+            return false;
+        if (!_filterName.empty() && !String::Contains(item.Name, _filterName.c_str(), true))
+            return false;
+        return true;
+    }
+
     bool GuestShouldBeVisible(const Guest& peep)
     {
         if (_trackingOnly && !(peep.PeepFlags & PEEP_FLAGS_TRACKING))
@@ -987,6 +1082,15 @@ void WindowGuestListRefreshList()
     auto* w = WindowFindByClass(WindowClass::GuestList);
     if (w != nullptr)
     {
-        static_cast<GuestListWindow*>(w)->RefreshList();
+        static_cast<GuestListWindow*>(w)->RequestListUpdate(true);
+    }
+}
+
+void WindowGuestListUpdateList()
+{
+    auto* w = WindowFindByClass(WindowClass::GuestList);
+    if (w != nullptr)
+    {
+        static_cast<GuestListWindow*>(w)->RequestListUpdate(false);
     }
 }
@@ -367,7 +367,7 @@ public:
 private:
     void UpdatePreview()
     {
-        TrackDesignDrawPreview(_trackDesign.get(), _trackDesignPreviewPixels.data());
+        TrackDesignDrawPreview(_trackDesign.get(), _trackDesignPreviewPixels.data(), _trackPath);
     }
 
     void InstallTrackDesign()
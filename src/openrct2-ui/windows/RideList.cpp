@@ -534,9 +534,10 @@ public:
         auto dpiCoords = ScreenCoordsXY{ dpi.x, dpi.y };
         GfxFillRect(dpi, { dpiCoords, dpiCoords + ScreenCoordsXY{ dpi.width, dpi.height } }, ColourMapA[colours[1]].mid_light);
 
-        auto y = 0;
-        for (size_t i = 0; i < _rideList.size(); i++)
+        const auto visibleRows = WindowGetVisibleScrollRows(dpi, SCROLLABLE_ROW_HEIGHT, _rideList.size());
+        for (auto i = visibleRows.First; i < visibleRows.Last; i++)
         {
+            const auto y = static_cast<int32_t>(i) * SCROLLABLE_ROW_HEIGHT;
             StringId format = (_quickDemolishMode ? STR_RED_STRINGID : STR_BLACK_STRING);
             if (i == static_cast<size_t>(selected_list_item))
             {
@@ -731,7 +732,6 @@ public:
                 ft.Add<StringId>(formatSecondary);
             }
             DrawTextEllipsised(dpi, { 160, y - 1 }, 157, format, ft);
-            y += SCROLLABLE_ROW_HEIGHT;
         }
     }
 
@@ -383,70 +383,60 @@ public:
         const int32_t actionColumnSize = nonIconSpace * 0.58;
         const int32_t actionOffset = widgets[WIDX_STAFF_LIST_LIST].right - actionColumnSize - 15;
 
-        auto y = 0;
-        size_t i = 0;
-        for (const auto& entry : _staffList)
+        const auto visibleRows = WindowGetVisibleScrollRows(dpi, SCROLLABLE_ROW_HEIGHT, _staffList.size());
+        for (auto i = visibleRows.First; i < visibleRows.Last; i++)
         {
-            if (y > dpi.y + dpi.height)
+            const auto y = static_cast<int32_t>(i) * SCROLLABLE_ROW_HEIGHT;
+
+            const auto* peep = GetEntity<Staff>(_staffList[i].Id);
+            if (peep == nullptr)
             {
-                break;
+                continue;
             }
+            int32_t format = (_quickFireMode ? STR_RED_STRINGID : STR_BLACK_STRING);
 
-            if (y + 11 >= dpi.y)
+            if (i == _highlightedIndex)
             {
-                const auto* peep = GetEntity<Staff>(entry.Id);
-                if (peep == nullptr)
-                {
-                    continue;
-                }
-                int32_t format = (_quickFireMode ? STR_RED_STRINGID : STR_BLACK_STRING);
+                GfxFilterRect(dpi, { 0, y, 800, y + (SCROLLABLE_ROW_HEIGHT - 1) }, FilterPaletteID::PaletteDarken1);
+                format = (_quickFireMode ? STR_LIGHTPINK_STRINGID : STR_WINDOW_COLOUR_2_STRINGID);
+            }
 
-                if (i == _highlightedIndex)
-                {
-                    GfxFilterRect(dpi, { 0, y, 800, y + (SCROLLABLE_ROW_HEIGHT - 1) }, FilterPaletteID::PaletteDarken1);
-                    format = (_quickFireMode ? STR_LIGHTPINK_STRINGID : STR_WINDOW_COLOUR_2_STRINGID);
-                }
+            auto ft = Formatter();
+            peep->FormatNameTo(ft);
+            DrawTextEllipsised(dpi, { 0, y }, nameColumnSize, format, ft);
 
-                auto ft = Formatter();
-                peep->FormatNameTo(ft);
-                DrawTextEllipsised(dpi, { 0, y }, nameColumnSize, format, ft);
+            ft = Formatter();
+            peep->FormatActionTo(ft);
+            DrawTextEllipsised(dpi, { actionOffset, y }, actionColumnSize, format, ft);
 
-                ft = Formatter();
-                peep->FormatActionTo(ft);
-                DrawTextEllipsised(dpi, { actionOffset, y }, actionColumnSize, format, ft);
+            // True if a patrol path is set for the worker
+            if (peep->HasPatrolArea())
+            {
+                GfxDrawSprite(dpi, ImageId(SPR_STAFF_PATROL_PATH), { nameColumnSize + 5, y });
+            }
 
-                // True if a patrol path is set for the worker
-                if (peep->HasPatrolArea())
-                {
-                    GfxDrawSprite(dpi, ImageId(SPR_STAFF_PATROL_PATH), { nameColumnSize + 5, y });
-                }
+            auto staffOrderIcon_x = nameColumnSize + 20;
+            if (peep->AssignedStaffType != StaffType::Entertainer)
+            {
+                auto staffOrders = peep->StaffOrders;
+                auto staffOrderSprite = GetStaffOrderBaseSprite(GetSelectedStaffType());
 
-                auto staffOrderIcon_x = nameColumnSize + 20;
-                if (peep->AssignedStaffType != StaffType::Entertainer)
+                while (staffOrders != 0)
                 {
-                    auto staffOrders = peep->StaffOrders;
-                    auto staffOrderSprite = GetStaffOrderBaseSprite(GetSelectedStaffType());
-
-                    while (staffOrders != 0)
+                    if (staffOrders & 1)
                     {
-                        if (staffOrders & 1)
-                        {
-                            GfxDrawSprite(dpi, ImageId(staffOrderSprite), { staffOrderIcon_x, y });
-                        }
-                        staffOrders = staffOrders >> 1;
-                        staffOrderIcon_x += 9;
-                        // TODO: Remove sprite ID addition
-                        staffOrderSprite++;
+                        GfxDrawSprite(dpi, ImageId(staffOrderSprite), { staffOrderIcon_x, y });
                     }
-                }
-                else
-                {
-                    GfxDrawSprite(dpi, ImageId(GetEntertainerCostumeSprite(peep->SpriteType)), { staffOrderIcon_x, y });
+                    staffOrders = staffOrders >> 1;
+                    staffOrderIcon_x += 9;
+                    // TODO: Remove sprite ID addition
+                    staffOrderSprite++;
                 }
             }
-
-            y += SCROLLABLE_ROW_HEIGHT;
-            i++;
+            else
+            {
+                GfxDrawSprite(dpi, ImageId(GetEntertainerCostumeSprite(peep->SpriteType)), { staffOrderIcon_x, y });
+            }
         }
     }
 
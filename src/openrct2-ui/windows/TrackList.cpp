@@ -192,7 +192,7 @@ private:
         _loadedTrackDesign = TrackDesignImport(path.c_str());
         if (_loadedTrackDesign != nullptr)
         {
-            TrackDesignDrawPreview(_loadedTrackDesign.get(), _trackDesignPreviewPixels.data());
+            TrackDesignDrawPreview(_loadedTrackDesign.get(), _trackDesignPreviewPixels.data(), path);
             return true;
         }
         return false;
@@ -98,6 +98,7 @@ WindowBase* WindowNewCampaignOpen(int16_t campaignType);
 
 WindowBase* WindowInstallTrackOpen(const utf8* path);
 void WindowGuestListRefreshList();
+void WindowGuestListUpdateList();
 WindowBase* WindowGuestListOpen();
 WindowBase* WindowGuestListOpenWithFilter(GuestListFilterType type, int32_t index);
 WindowBase* WindowStaffFirePromptOpen(Peep* peep);
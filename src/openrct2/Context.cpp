@@ -44,6 +44,7 @@
 #include "drawing/LightFX.h"
 #include "entity/EntityRegistry.h"
 #include "entity/EntityTweener.h"
+#include "interface/CaptureQueue.h"
 #include "interface/Chat.h"
 #include "interface/InteractiveConsole.h"
 #include "interface/Viewport.h"
@@ -62,6 +63,7 @@
 #include "platform/Platform.h"
 #include "profiling/Profiling.h"
 #include "ride/TrackData.h"
+#include "ride/TrackDesignPreviewCache.h"
 #include "ride/TrackDesignRepository.h"
 #include "scenario/Scenario.h"
 #include "scenario/ScenarioRepository.h"
@@ -186,6 +188,8 @@ namespace OpenRCT2
             _network.Close();
 #endif
             WindowCloseAll();
+            TrackDesignPreviewCache::Shutdown();
+            CaptureQueue::Shutdown();
 
             // Unload objects after closing all windows, this is to overcome windows like
             // the object selection window which loads objects when closed.
@@ -19,6 +19,7 @@
 #include "Input.h"
 #include "OpenRCT2.h"
 #include "ReplayManager.h"
+#include "TickWatchdog.h"
 #include "actions/GameAction.h"
 #include "config/Config.h"
 #include "entity/EntityRegistry.h"
@@ -38,6 +39,7 @@
 #include "title/TitleScreen.h"
 #include "title/TitleSequencePlayer.h"
 #include "ui/UiContext.h"
+#include "util/Util.h"
 #include "windows/Intent.h"
 #include "world/Climate.h"
 #include "world/MapAnimation.h"
@@ -50,11 +52,48 @@
 using namespace OpenRCT2;
 using namespace OpenRCT2::Scripting;
 
+// clang-format off
+static constexpr const char* LogicTimePartNames[] =
+{
+    "NetworkUpdate",
+    "Date",
+    "Scenario",
+    "Climate",
+    "MapTiles",
+    "MapStashProvisionalElements",
+    "MapPathWideFlags",
+    "Peep",
+    "MapRestoreProvisionalElements",
+    "Vehicle",
+    "Misc",
+    "Ride",
+    "Park",
+    "Research",
+    "RideRatings",
+    "RideMeasurments",
+    "News",
+    "MapAnimation",
+    "Sounds",
+    "GameActions",
+    "NetworkFlush",
+    "Scripts",
+};
+// clang-format on
+static_assert(std::size(LogicTimePartNames) == EnumValue(LogicTimePart::Count));
+
+const char* OpenRCT2::GetLogicTimePartName(LogicTimePart part)
+{
+    return LogicTimePartNames[EnumValue(part)];
+}
+
 GameState::GameState()
 {
     _park = std::make_unique<Park>();
+    _tickWatchdog = std::make_unique<TickWatchdog>();
 }
 
+GameState::~GameState() = default;
+
 /**
  * Initialises the map, park etc. basically all S6 data.
  */
@@ -255,11 +294,14 @@ void GameState::UpdateLogic(LogicTimings* timings)
     PROFILED_FUNCTION();
 
     auto start_time = std::chrono::high_resolution_clock::now();
+    _tickWatchdog->BeginTick();
 
-    auto report_time = [timings, start_time](LogicTimePart part) {
+    auto report_time = [this, timings, start_time](LogicTimePart part) {
+        const auto elapsed = std::chrono::high_resolution_clock::now() - start_time;
+        _tickWatchdog->ReportTime(part, elapsed);
         if (timings != nullptr)
         {
-            timings->TimingInfo[part][timings->CurrentIdx] = std::chrono::high_resolution_clock::now() - start_time;
+            timings->TimingInfo[part][timings->CurrentIdx] = elapsed;
         }
     };
 
@@ -398,6 +440,9 @@ void GameState::UpdateLogic(LogicTimings* timings)
         timings->CurrentIdx = (timings->CurrentIdx + 1) % LOGIC_UPDATE_MEASUREMENTS_COUNT;
     }
 
+    _tickWatchdog->EndTick(gCurrentTicks, std::chrono::high_resolution_clock::now() - start_time);
+    Profiling::Tick();
+
     gInUpdateCode = false;
 }
 
@@ -20,6 +20,7 @@
 namespace OpenRCT2
 {
     class Park;
+    class TickWatchdog;
 
     // Information regarding various pieces of logic update
     enum class LogicTimePart
@@ -46,8 +47,11 @@ namespace OpenRCT2
         GameActions,
         NetworkFlush,
         Scripts,
+        Count,
     };
 
+    const char* GetLogicTimePartName(LogicTimePart part);
+
     // ~6.5s at 40Hz
     constexpr size_t LOGIC_UPDATE_MEASUREMENTS_COUNT = 256;
 
@@ -68,11 +72,13 @@ namespace OpenRCT2
     {
     private:
         std::unique_ptr<Park> _park;
+        std::unique_ptr<TickWatchdog> _tickWatchdog;
         Date _date;
 
     public:
         GameState();
         GameState(const GameState&) = delete;
+        ~GameState();
 
         Date& GetDate()
         {
@@ -82,6 +88,10 @@ namespace OpenRCT2
         {
             return *_park;
         }
+        TickWatchdog& GetTickWatchdog()
+        {
+            return *_tickWatchdog;
+        }
 
         void InitAll(const TileCoordsXY& mapSize);
         void Tick();
@@ -678,44 +678,6 @@ struct GameStateSnapshots final : public IGameStateSnapshots
         return res;
     }
 
-    static const char* GetEntityTypeName(EntityType type)
-    {
-        switch (type)
-        {
-            case EntityType::Null:
-                return "Null";
-            case EntityType::Guest:
-                return "Guest";
-            case EntityType::Staff:
-                return "Staff";
-            case EntityType::Vehicle:
-                return "Vehicle";
-            case EntityType::Litter:
-                return "Litter";
-            case EntityType::SteamParticle:
-                return "Misc: Steam Particle";
-            case EntityType::MoneyEffect:
-                return "Misc: Money effect";
-            case EntityType::CrashedVehicleParticle:
-                return "Misc: Crash Vehicle Particle";
-            case EntityType::ExplosionCloud:
-                return "Misc: Explosion Cloud";
-            case EntityType::CrashSplash:
-                return "Misc: Crash Splash";
-            case EntityType::ExplosionFlare:
-                return "Misc: Explosion Flare";
-            case EntityType::JumpingFountain:
-                return "Misc: Jumping fountain";
-            case EntityType::Balloon:
-                return "Misc: Balloon";
-            case EntityType::Duck:
-                return "Misc: Duck";
-            default:
-                break;
-        }
-        return "Unknown";
-    }
-
     virtual std::string GetCompareDataText(const GameStateCompareData& cmpData) const override
     {
         std::string outputBuffer;
@@ -0,0 +1,137 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TickWatchdog.h"
+
+#include "Context.h"
+#include "Diagnostic.h"
+#include "PlatformEnvironment.h"
+#include "actions/GameAction.h"
+#include "config/Config.h"
+#include "core/FileSystem.hpp"
+#include "core/Path.hpp"
+#include "entity/EntityList.h"
+#include "network/network.h"
+
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+
+using namespace OpenRCT2;
+
+using Milliseconds = std::chrono::duration<double, std::milli>;
+
+void TickWatchdog::BeginTick()
+{
+    _partEndMs.fill(-1.0);
+    _gameActions.clear();
+}
+
+void TickWatchdog::ReportTime(LogicTimePart part, Clock::duration elapsed)
+{
+    _partEndMs[EnumValue(part)] = Milliseconds(elapsed).count();
+}
+
+void TickWatchdog::RecordGameAction(const char* name, Clock::duration elapsed)
+{
+    _gameActions.push_back({ name, Milliseconds(elapsed).count() });
+}
+
+void TickWatchdog::EndTick(uint32_t tick, Clock::duration elapsed)
+{
+    const auto elapsedMs = Milliseconds(elapsed).count();
+    _samples[_numSamples % NumSamples] = static_cast<float>(elapsedMs);
+    _numSamples++;
+
+    const auto budgetMs = gConfigNetwork.TickBudget;
+    if (budgetMs > 0 && elapsedMs > budgetMs)
+    {
+        _numHitches++;
+        WriteHitch(tick, elapsedMs, budgetMs);
+    }
+
+    if (_numSamples % NumSamples == 0 && NetworkGetMode() == NETWORK_MODE_SERVER)
+    {
+        LogStatistics();
+    }
+}
+
+TickStatistics TickWatchdog::GetStatistics() const
+{
+    TickStatistics stats;
+    stats.NumTicks = std::min<uint32_t>(_numSamples, NumSamples);
+    stats.NumHitches = _numHitches;
+    if (stats.NumTicks == 0)
+        return stats;
+
+    std::vector<float> samples(_samples.begin(), _samples.begin() + stats.NumTicks);
+    auto percentile = [&samples](double p) {
+        auto it = samples.begin() + static_cast<size_t>(p * (samples.size() - 1));
+        std::nth_element(samples.begin(), it, samples.end());
+        return static_cast<double>(*it);
+    };
+    stats.P50Ms = percentile(0.5);
+    stats.P99Ms = percentile(0.99);
+    stats.MaxMs = *std::max_element(samples.begin(), samples.end());
+    return stats;
+}
+
+void TickWatchdog::WriteHitch(uint32_t tick, double elapsedMs, int32_t budgetMs) const
+{
+    auto env = GetContext()->GetPlatformEnvironment();
+    auto directory = env->GetDirectoryPath(DIRBASE::USER, DIRID::LOG_SERVER);
+    auto path = Path::Combine(directory, u8"tick_hitches.log");
+
+    std::ofstream fs(fs::u8path(path), std::ios::out | std::ios::app);
+    if (!fs.is_open())
+    {
+        LOG_ERROR("Unable to write tick hitch to %s", path.c_str());
+        return;
+    }
+
+    auto timer = std::time(nullptr);
+    fs << std::put_time(std::localtime(&timer), "[%Y/%m/%d %H:%M:%S] ");
+    fs << std::fixed << std::setprecision(2);
+    fs << "Tick " << tick << " took " << elapsedMs << " ms, budget is " << budgetMs << " ms\n";
+
+    fs << "  Timeline:\n";
+    double partStartMs = 0;
+    for (size_t i = 0; i < _partEndMs.size(); i++)
+    {
+        if (_partEndMs[i] < 0)
+            continue;
+
+        fs << "    " << std::setw(8) << partStartMs << " ms  " << GetLogicTimePartName(static_cast<LogicTimePart>(i))
+           << " " << (_partEndMs[i] - partStartMs) << " ms\n";
+        partStartMs = _partEndMs[i];
+    }
+
+    fs << "  Entities:\n";
+    for (size_t i = 0; i < EnumValue(EntityType::Count); i++)
+    {
+        const auto type = static_cast<EntityType>(i);
+        fs << "    " << GetEntityTypeName(type) << ": " << GetEntityListCount(type) << "\n";
+    }
+
+    fs << "  Game actions: " << _gameActions.size() << ", still queued: " << GameActions::GetQueueSize() << "\n";
+    for (const auto& action : _gameActions)
+    {
+        fs << "    " << action.Name << " " << action.Ms << " ms\n";
+    }
+}
+
+void TickWatchdog::LogStatistics() const
+{
+    // Not written to the server log, which is only kept when server actions are logged
+    const auto stats = GetStatistics();
+    LOG_INFO(
+        "Tick times over the last %u ticks: p50 %.2f ms, p99 %.2f ms, max %.2f ms, %u ticks over budget in total",
+        stats.NumTicks, stats.P50Ms, stats.P99Ms, stats.MaxMs, stats.NumHitches);
+}
@@ -0,0 +1,70 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "GameState.h"
+#include "util/Util.h"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace OpenRCT2
+{
+    struct TickStatistics
+    {
+        uint32_t NumTicks{};
+        double P50Ms{};
+        double P99Ms{};
+        double MaxMs{};
+        uint32_t NumHitches{};
+    };
+
+    /**
+     * Times every game tick by LogicTimePart. Ticks that take longer than the tick budget in the
+     * network configuration are written to a log with the entity counts and the game actions
+     * executed during the tick.
+     */
+    class TickWatchdog final
+    {
+    public:
+        using Clock = std::chrono::high_resolution_clock;
+
+        // One minute at 40 Hz.
+        static constexpr size_t NumSamples = 2400;
+
+        void BeginTick();
+        void ReportTime(LogicTimePart part, Clock::duration elapsed);
+        void RecordGameAction(const char* name, Clock::duration elapsed);
+        void EndTick(uint32_t tick, Clock::duration elapsed);
+
+        // Returns the statistics of the last NumSamples ticks.
+        TickStatistics GetStatistics() const;
+
+    private:
+        struct GameActionTiming
+        {
+            const char* Name;
+            double Ms;
+        };
+
+        // Time elapsed since the start of the tick when each part finished, negative if the part did not run.
+        std::array<double, EnumValue(LogicTimePart::Count)> _partEndMs{};
+        std::vector<GameActionTiming> _gameActions;
+
+        std::array<float, NumSamples> _samples{};
+        uint32_t _numSamples{};
+        uint32_t _numHitches{};
+
+        void WriteHitch(uint32_t tick, double elapsedMs, int32_t budgetMs) const;
+        void LogStatistics() const;
+    };
+} // namespace OpenRCT2
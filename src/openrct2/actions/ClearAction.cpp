@@ -78,7 +78,7 @@ GameActions::Result ClearAction::QueryExecute(bool executing) const
     auto noValidTiles = true;
     auto error = GameActions::Status::Ok;
     StringId errorMessage = STR_NONE;
-    money64 totalCost = 0;
+    GameActions::NestedActionBatch batch(executing);
 
     auto validRange = ClampRangeWithinMap(_range);
     for (int32_t y = validRange.GetTop(); y <= validRange.GetBottom(); y += COORDS_XY_STEP)
@@ -87,12 +87,8 @@ GameActions::Result ClearAction::QueryExecute(bool executing) const
         {
             if (LocationValid({ x, y }) && MapCanClearAt({ x, y }))
             {
-                auto cost = ClearSceneryFromTile({ x, y }, executing);
-                if (cost != MONEY64_UNDEFINED)
-                {
-                    noValidTiles = false;
-                    totalCost += cost;
-                }
+                ClearSceneryFromTile({ x, y }, batch);
+                noValidTiles = false;
             }
             else
             {
@@ -104,7 +100,7 @@ GameActions::Result ClearAction::QueryExecute(bool executing) const
 
     if (_itemsToClear & CLEARABLE_ITEMS::SCENERY_LARGE)
     {
-        ResetClearLargeSceneryFlag();
+        ResetClearLargeSceneryFlag(validRange);
     }
 
     if (noValidTiles)
@@ -113,22 +109,21 @@ GameActions::Result ClearAction::QueryExecute(bool executing) const
         result.ErrorMessage = errorMessage;
     }
 
-    result.Cost = totalCost;
+    result.Cost = batch.GetCost();
     return result;
 }
 
-money64 ClearAction::ClearSceneryFromTile(const CoordsXY& tilePos, bool executing) const
+void ClearAction::ClearSceneryFromTile(const CoordsXY& tilePos, GameActions::NestedActionBatch& batch) const
 {
     // Pass down all flags.
     TileElement* tileElement = nullptr;
-    money64 totalCost = 0;
     bool tileEdited;
     do
     {
         tileEdited = false;
         tileElement = MapGetFirstElementAt(tilePos);
         if (tileElement == nullptr)
-            return totalCost;
+            return;
         do
         {
             if (tileElement->IsGhost())
@@ -142,14 +137,7 @@ money64 ClearAction::ClearSceneryFromTile(const CoordsXY& tilePos, bool executin
                         auto footpathRemoveAction = FootpathRemoveAction({ tilePos, tileElement->GetBaseZ() });
                         footpathRemoveAction.SetFlags(GetFlags());
 
-                        auto res = executing ? GameActions::ExecuteNested(&footpathRemoveAction)
-                                             : GameActions::QueryNested(&footpathRemoveAction);
-
-                        if (res.Error == GameActions::Status::Ok)
-                        {
-                            totalCost += res.Cost;
-                            tileEdited = executing;
-                        }
+                        tileEdited = batch.Run(footpathRemoveAction) && batch.IsExecuting();
                     }
                     break;
                 case TileElementType::SmallScenery:
@@ -160,14 +148,7 @@ money64 ClearAction::ClearSceneryFromTile(const CoordsXY& tilePos, bool executin
                             tileElement->AsSmallScenery()->GetEntryIndex());
                         removeSceneryAction.SetFlags(GetFlags());
 
-                        auto res = executing ? GameActions::ExecuteNested(&removeSceneryAction)
-                                             : GameActions::QueryNested(&removeSceneryAction);
-
-                        if (res.Error == GameActions::Status::Ok)
-                        {
-                            totalCost += res.Cost;
-                            tileEdited = executing;
-                        }
+                        tileEdited = batch.Run(removeSceneryAction) && batch.IsExecuting();
                     }
                     break;
                 case TileElementType::Wall:
@@ -177,14 +158,7 @@ money64 ClearAction::ClearSceneryFromTile(const CoordsXY& tilePos, bool executin
                         auto wallRemoveAction = WallRemoveAction(wallLocation);
                         wallRemoveAction.SetFlags(GetFlags());
 
-                        auto res = executing ? GameActions::ExecuteNested(&wallRemoveAction)
-                                             : GameActions::QueryNested(&wallRemoveAction);
-
-                        if (res.Error == GameActions::Status::Ok)
-                        {
-                            totalCost += res.Cost;
-                            tileEdited = executing;
-                        }
+                        tileEdited = batch.Run(wallRemoveAction) && batch.IsExecuting();
                     }
                     break;
                 case TileElementType::LargeScenery:
@@ -195,14 +169,7 @@ money64 ClearAction::ClearSceneryFromTile(const CoordsXY& tilePos, bool executin
                             tileElement->AsLargeScenery()->GetSequenceIndex());
                         removeSceneryAction.SetFlags(GetFlags() | GAME_COMMAND_FLAG_TRACK_DESIGN);
 
-                        auto res = executing ? GameActions::ExecuteNested(&removeSceneryAction)
-                                             : GameActions::QueryNested(&removeSceneryAction);
-
-                        if (res.Error == GameActions::Status::Ok)
-                        {
-                            totalCost += res.Cost;
-                            tileEdited = executing;
-                        }
+                        tileEdited = batch.Run(removeSceneryAction) && batch.IsExecuting();
                     }
                     break;
                 default:
@@ -210,18 +177,16 @@ money64 ClearAction::ClearSceneryFromTile(const CoordsXY& tilePos, bool executin
             }
         } while (!tileEdited && !(tileElement++)->IsLastForTile());
     } while (tileEdited);
-
-    return totalCost;
 }
 
-void ClearAction::ResetClearLargeSceneryFlag()
+void ClearAction::ResetClearLargeSceneryFlag(const MapRange& range)
 {
-    // TODO: Improve efficiency of this
-    for (int32_t y = 0; y < gMapSize.y; y++)
+    // LargeSceneryRemoveAction only marks the element it is given, which is always on a tile in the range.
+    for (int32_t y = range.GetTop(); y <= range.GetBottom(); y += COORDS_XY_STEP)
     {
-        for (int32_t x = 0; x < gMapSize.x; x++)
+        for (int32_t x = range.GetLeft(); x <= range.GetRight(); x += COORDS_XY_STEP)
         {
-            auto tileElement = MapGetFirstElementAt(TileCoordsXY{ x, y });
+            auto tileElement = MapGetFirstElementAt(CoordsXY{ x, y });
             do
             {
                 if (tileElement == nullptr)
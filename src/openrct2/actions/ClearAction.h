@@ -45,13 +45,13 @@ public:
 private:
     GameActions::Result CreateResult() const;
     GameActions::Result QueryExecute(bool executing) const;
-    money64 ClearSceneryFromTile(const CoordsXY& tilePos, bool executing) const;
+    void ClearSceneryFromTile(const CoordsXY& tilePos, GameActions::NestedActionBatch& batch) const;
 
     /**
      * Function to clear the flag that is set to prevent cost duplication
      * when using the clear scenery tool with large scenery.
      */
-    static void ResetClearLargeSceneryFlag();
+    static void ResetClearLargeSceneryFlag(const MapRange& range);
 
     static bool MapCanClearAt(const CoordsXY& location);
 };
@@ -11,6 +11,8 @@
 
 #include "../Context.h"
 #include "../ReplayManager.h"
+#include "../TickWatchdog.h"
+#include "../config/Config.h"
 #include "../core/Guard.hpp"
 #include "../core/Memory.hpp"
 #include "../core/MemoryStream.h"
@@ -30,39 +32,52 @@
 #include "../world/Scenery.h"
 
 #include <algorithm>
+#include <chrono>
 #include <iterator>
+#include <vector>
 
 using namespace OpenRCT2;
 
 namespace GameActions
 {
+    using QueueClock = std::chrono::steady_clock;
+
     struct QueuedGameAction
     {
         uint32_t tick;
         uint32_t uniqueId;
         GameAction::Ptr action;
+        QueueClock::time_point enqueueTime;
 
         explicit QueuedGameAction(uint32_t t, std::unique_ptr<GameAction>&& ga, uint32_t id)
             : tick(t)
             , uniqueId(id)
             , action(std::move(ga))
+            , enqueueTime(QueueClock::now())
         {
         }
+    };
+
+    /**
+     * All actions queued for the same tick in the order they arrived. Actions are taken from the front by advancing
+     * next, the vector is only cleared once the bucket is empty so it can be reused without allocating.
+     */
+    struct QueuedTickBucket
+    {
+        uint32_t tick{};
+        size_t next{};
+        std::vector<QueuedGameAction> actions;
 
-        bool operator<(const QueuedGameAction& comp) const
+        bool IsEmpty() const
         {
-            // First sort by tick
-            if (tick < comp.tick)
-                return true;
-            if (tick > comp.tick)
-                return false;
-
-            // If the ticks are equal sort by commandIndex
-            return uniqueId < comp.uniqueId;
+            return next >= actions.size();
         }
     };
 
-    static std::multiset<QueuedGameAction> _actionQueue;
+    // Buckets sorted by tick, there are usually only a few as actions are queued for the current or next tick.
+    static std::vector<QueuedTickBucket> _actionQueue;
+    static std::vector<QueuedTickBucket> _freeBuckets;
+    static size_t _actionQueueSize = 0;
     static uint32_t _nextUniqueId = 0;
     static bool _suspended = false;
 
@@ -76,6 +91,36 @@ namespace GameActions
         _suspended = false;
     }
 
+    static QueuedTickBucket& GetTickBucket(uint32_t tick)
+    {
+        // Actions almost always arrive for the latest tick, so search from the back.
+        auto it = _actionQueue.end();
+        while (it != _actionQueue.begin() && std::prev(it)->tick >= tick)
+        {
+            --it;
+            if (it->tick == tick)
+                return *it;
+        }
+
+        QueuedTickBucket bucket;
+        if (!_freeBuckets.empty())
+        {
+            bucket = std::move(_freeBuckets.back());
+            _freeBuckets.pop_back();
+        }
+        bucket.tick = tick;
+        return *_actionQueue.insert(it, std::move(bucket));
+    }
+
+    static void RecycleFrontBucket()
+    {
+        auto& bucket = _actionQueue.front();
+        bucket.actions.clear();
+        bucket.next = 0;
+        _freeBuckets.push_back(std::move(bucket));
+        _actionQueue.erase(_actionQueue.begin());
+    }
+
     void Enqueue(const GameAction* ga, uint32_t tick)
     {
         auto action = Clone(ga);
@@ -90,7 +135,22 @@ namespace GameActions
             // as that normally happens when receiving them over network.
             ga->SetPlayer(NetworkGetCurrentPlayerId());
         }
-        _actionQueue.emplace(tick, std::move(ga), _nextUniqueId++);
+        GetTickBucket(tick).actions.emplace_back(tick, std::move(ga), _nextUniqueId++);
+        _actionQueueSize++;
+    }
+
+    static void LogQueuedActionLatency(const QueuedGameAction& queued, uint32_t currentTick)
+    {
+        if (NetworkGetMode() != NETWORK_MODE_SERVER || !gConfigNetwork.LogServerActions)
+            return;
+
+        const auto latencyMs = std::chrono::duration<double, std::milli>(QueueClock::now() - queued.enqueueTime).count();
+        char text[256];
+        snprintf(
+            text, sizeof(text), "[sv] Tick: %u, GA: %s queued for %.2f ms (%d ticks), queue depth %u", currentTick,
+            queued.action->GetName(), latencyMs, static_cast<int32_t>(currentTick - queued.tick),
+            static_cast<uint32_t>(_actionQueueSize));
+        NetworkAppendServerLog(text);
     }
 
     void ProcessQueue()
@@ -103,29 +163,41 @@ namespace GameActions
 
         const uint32_t currentTick = gCurrentTicks;
 
-        while (_actionQueue.begin() != _actionQueue.end())
+        while (!_actionQueue.empty())
         {
-            // run all the game commands at the current tick
-            const QueuedGameAction& queued = *_actionQueue.begin();
+            if (_actionQueue.front().IsEmpty())
+            {
+                RecycleFrontBucket();
+                continue;
+            }
 
+            // run all the game commands at the current tick
+            auto& bucket = _actionQueue.front();
             if (NetworkGetMode() == NETWORK_MODE_CLIENT)
             {
-                if (queued.tick < currentTick)
+                if (bucket.tick < currentTick)
                 {
                     // This should never happen.
+                    const QueuedGameAction& front = bucket.actions[bucket.next];
                     Guard::Assert(
                         false,
                         "Discarding game action %s (%u) from tick behind current tick, ID: %08X, Action Tick: %08X, Current "
                         "Tick: "
                         "%08X\n",
-                        queued.action->GetName(), queued.action->GetType(), queued.uniqueId, queued.tick, currentTick);
+                        front.action->GetName(), front.action->GetType(), front.uniqueId, front.tick, currentTick);
                 }
-                else if (queued.tick > currentTick)
+                else if (bucket.tick > currentTick)
                 {
                     return;
                 }
             }
 
+            // Executing the action may queue more actions which can move the buckets, so take it out first.
+            QueuedGameAction queued = std::move(bucket.actions[bucket.next++]);
+            _actionQueueSize--;
+
+            LogQueuedActionLatency(queued, currentTick);
+
             // Remove ghost scenery so it doesn't interfere with incoming network command
             switch (queued.action->GetType())
             {
@@ -150,14 +222,21 @@ namespace GameActions
                 // Relay this action to all other clients.
                 NetworkSendGameAction(action);
             }
-
-            _actionQueue.erase(_actionQueue.begin());
         }
     }
 
     void ClearQueue()
     {
-        _actionQueue.clear();
+        while (!_actionQueue.empty())
+        {
+            RecycleFrontBucket();
+        }
+        _actionQueueSize = 0;
+    }
+
+    size_t GetQueueSize()
+    {
+        return _actionQueueSize;
     }
 
     GameAction::Ptr Clone(const GameAction* action)
@@ -242,11 +321,18 @@ namespace GameActions
 
     struct ActionLogContext
     {
+        // Serialising the action is only worth it if the text ends up in a log, nested actions of area tools run
+        // thousands of times per action.
+        bool Enabled = _log_levels[EnumValue(DiagnosticLevel::Verbose)]
+            || (NetworkGetMode() != NETWORK_MODE_NONE && gConfigNetwork.LogServerActions);
         MemoryStream output;
     };
 
     static void LogActionBegin(ActionLogContext& ctx, const GameAction* action)
     {
+        if (!ctx.Enabled)
+            return;
+
         MemoryStream& output = ctx.output;
 
         char temp[128] = {};
@@ -264,6 +350,9 @@ namespace GameActions
 
     static void LogActionFinish(ActionLogContext& ctx, const GameAction* action, const GameActions::Result& result)
     {
+        if (!ctx.Enabled)
+            return;
+
         MemoryStream& output = ctx.output;
 
         char temp[128] = {};
@@ -314,7 +403,7 @@ namespace GameActions
             && ((NetworkGetMode() == NETWORK_MODE_NONE) || (flags & GAME_COMMAND_FLAG_NETWORKED)))
         {
             auto& scriptEngine = GetContext()->GetScriptEngine();
-            scriptEngine.RunGameActionHooks(*action, result, false);
+            scriptEngine.RunGameActionHooks(*action, result, false, topLevel);
             // Script hooks may now have changed the game action result...
         }
 #endif
@@ -353,12 +442,18 @@ namespace GameActions
             LogActionBegin(logContext, action);
 
             // Execute the action, changing the game state
+            const auto executeStartTime = TickWatchdog::Clock::now();
             result = action->Execute();
+            if (topLevel && gInUpdateCode)
+            {
+                GetContext()->GetGameState()->GetTickWatchdog().RecordGameAction(
+                    action->GetName(), TickWatchdog::Clock::now() - executeStartTime);
+            }
 #ifdef ENABLE_SCRIPTING
             if (result.Error == GameActions::Status::Ok)
             {
                 auto& scriptEngine = GetContext()->GetScriptEngine();
-                scriptEngine.RunGameActionHooks(*action, result, true);
+                scriptEngine.RunGameActionHooks(*action, result, true, topLevel);
                 // Script hooks may now have changed the game action result...
             }
 #endif
@@ -463,6 +558,24 @@ namespace GameActions
     {
         return ExecuteInternal(action, false);
     }
+
+    NestedActionBatch::NestedActionBatch(bool executing)
+        : _executing(executing)
+    {
+    }
+
+    bool NestedActionBatch::Run(const GameAction& action)
+    {
+        auto result = _executing ? ExecuteInternal(&action, false) : QueryInternal(&action, false);
+        if (result.Error != Status::Ok)
+        {
+            _lastFailure = std::move(result);
+            return false;
+        }
+
+        _cost += result.Cost;
+        return true;
+    }
 } // namespace GameActions
 
 const char* GameAction::GetName() const
@@ -282,6 +282,9 @@ namespace GameActions
     void ProcessQueue();
     void ClearQueue();
 
+    // Number of actions waiting in the queue.
+    size_t GetQueueSize();
+
     GameAction::Ptr Create(GameCommand id);
     GameAction::Ptr Clone(const GameAction* action);
 
@@ -293,4 +296,38 @@ namespace GameActions
     GameActions::Result QueryNested(const GameAction* action);
     GameActions::Result ExecuteNested(const GameAction* action);
 
+    /**
+     * Queries or executes the nested actions of an area tool. Only the total cost and the last failure are kept, so a
+     * whole range can be validated or executed in one pass without holding on to a result for every tile.
+     */
+    class NestedActionBatch final
+    {
+    public:
+        explicit NestedActionBatch(bool executing);
+
+        // Returns true if the action succeeded, its cost is then added to the total.
+        bool Run(const GameAction& action);
+
+        bool IsExecuting() const
+        {
+            return _executing;
+        }
+
+        money64 GetCost() const
+        {
+            return _cost;
+        }
+
+        // The result of the action that failed last, for area tools that fail as a whole when one action fails.
+        const Result& GetLastFailure() const
+        {
+            return _lastFailure;
+        }
+
+    private:
+        bool _executing;
+        money64 _cost = 0;
+        Result _lastFailure;
+    };
+
 } // namespace GameActions
@@ -94,10 +94,10 @@ GameActions::Result LandSetRightsAction::QueryExecute(bool isExecuting) const
         {
             if (!LocationValid({ x, y }))
                 continue;
-            auto result = MapBuyLandRightsForTile({ x, y }, isExecuting);
-            if (result.Error == GameActions::Status::Ok)
+            auto cost = MapBuyLandRightsForTile({ x, y }, isExecuting);
+            if (cost != MONEY64_UNDEFINED)
             {
-                res.Cost += result.Cost;
+                res.Cost += cost;
             }
         }
     }
@@ -110,16 +110,15 @@ GameActions::Result LandSetRightsAction::QueryExecute(bool isExecuting) const
     return res;
 }
 
-GameActions::Result LandSetRightsAction::MapBuyLandRightsForTile(const CoordsXY& loc, bool isExecuting) const
+money64 LandSetRightsAction::MapBuyLandRightsForTile(const CoordsXY& loc, bool isExecuting) const
 {
     SurfaceElement* surfaceElement = MapGetSurfaceElementAt(loc);
     if (surfaceElement == nullptr)
     {
         LOG_ERROR("Could not find surface. x = %d, y = %d", loc.x, loc.y);
-        return GameActions::Result(GameActions::Status::InvalidParameters, STR_NONE, STR_NONE);
+        return MONEY64_UNDEFINED;
     }
 
-    auto res = GameActions::Result();
     switch (_setting)
     {
         case LandSetRightSetting::UnownLand:
@@ -129,7 +128,7 @@ GameActions::Result LandSetRightsAction::MapBuyLandRightsForTile(const CoordsXY&
                     surfaceElement->GetOwnership() & ~(OWNERSHIP_OWNED | OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED));
                 ParkUpdateFencesAroundTile(loc);
             }
-            return res;
+            return 0;
         case LandSetRightSetting::UnownConstructionRights:
             if (isExecuting)
             {
@@ -137,7 +136,7 @@ GameActions::Result LandSetRightsAction::MapBuyLandRightsForTile(const CoordsXY&
                 uint16_t baseZ = surfaceElement->GetBaseZ();
                 MapInvalidateTile({ loc, baseZ, baseZ + 16 });
             }
-            return res;
+            return 0;
         case LandSetRightSetting::SetForSale:
             if (isExecuting)
             {
@@ -145,7 +144,7 @@ GameActions::Result LandSetRightsAction::MapBuyLandRightsForTile(const CoordsXY&
                 uint16_t baseZ = surfaceElement->GetBaseZ();
                 MapInvalidateTile({ loc, baseZ, baseZ + 16 });
             }
-            return res;
+            return 0;
         case LandSetRightSetting::SetConstructionRightsForSale:
             if (isExecuting)
             {
@@ -153,12 +152,12 @@ GameActions::Result LandSetRightsAction::MapBuyLandRightsForTile(const CoordsXY&
                 uint16_t baseZ = surfaceElement->GetBaseZ();
                 MapInvalidateTile({ loc, baseZ, baseZ + 16 });
             }
-            return res;
+            return 0;
         case LandSetRightSetting::SetOwnershipWithChecks:
         {
             if (_ownership == surfaceElement->GetOwnership())
             {
-                return res;
+                return 0;
             }
 
             for (auto* entranceElement : TileElementsView<EntranceElement>(loc))
@@ -168,7 +167,7 @@ GameActions::Result LandSetRightsAction::MapBuyLandRightsForTile(const CoordsXY&
 
                 // Do not allow ownership of park entrance.
                 if (_ownership == OWNERSHIP_OWNED || _ownership == OWNERSHIP_AVAILABLE)
-                    return res;
+                    return 0;
 
                 // Allow construction rights available / for sale on park entrances on surface.
                 // There is no need to check the height if _ownership is 0 (unowned and no rights available).
@@ -177,12 +176,11 @@ GameActions::Result LandSetRightsAction::MapBuyLandRightsForTile(const CoordsXY&
                     if (entranceElement->BaseHeight - 3 > surfaceElement->BaseHeight
                         || entranceElement->BaseHeight < surfaceElement->BaseHeight)
                     {
-                        return res;
+                        return 0;
                     }
                 }
             }
 
-            res.Cost = gLandPrice;
             if (isExecuting)
             {
                 if (_ownership != OWNERSHIP_UNOWNED)
@@ -199,10 +197,10 @@ GameActions::Result LandSetRightsAction::MapBuyLandRightsForTile(const CoordsXY&
                 ParkUpdateFencesAroundTile(loc);
                 gMapLandRightsUpdateSuccess = true;
             }
-            return res;
+            return gLandPrice;
         }
         default:
             LOG_WARNING("Tried calling set land rights with an incorrect setting. setting = %u", _setting);
-            return GameActions::Result(GameActions::Status::InvalidParameters, STR_NONE, STR_NONE);
+            return MONEY64_UNDEFINED;
     }
 }
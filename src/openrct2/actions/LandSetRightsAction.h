@@ -43,5 +43,5 @@ public:
 
 private:
     GameActions::Result QueryExecute(bool isExecuting) const;
-    GameActions::Result MapBuyLandRightsForTile(const CoordsXY& loc, bool isExecuting) const;
+    money64 MapBuyLandRightsForTile(const CoordsXY& loc, bool isExecuting) const;
 };
@@ -64,8 +64,8 @@ GameActions::Result LandSmoothAction::Execute() const
     return SmoothLand(true);
 }
 
-GameActions::Result LandSmoothAction::SmoothLandTile(
-    int32_t direction, bool isExecuting, const CoordsXY& loc, SurfaceElement* surfaceElement) const
+void LandSmoothAction::SmoothLandTile(
+    int32_t direction, GameActions::NestedActionBatch& batch, const CoordsXY& loc, SurfaceElement* surfaceElement) const
 {
     int32_t targetBaseZ = surfaceElement->BaseHeight;
     int32_t slope = surfaceElement->GetSlope();
@@ -90,29 +90,27 @@ GameActions::Result LandSmoothAction::SmoothLandTile(
 
     auto landSetHeightAction = LandSetHeightAction(loc, targetBaseZ, slope);
     landSetHeightAction.SetFlags(GetFlags());
-    auto res = isExecuting ? GameActions::ExecuteNested(&landSetHeightAction) : GameActions::QueryNested(&landSetHeightAction);
-
-    return res;
+    batch.Run(landSetHeightAction);
 }
 
-money64 LandSmoothAction::SmoothLandRowByEdge(
-    bool isExecuting, const CoordsXY& loc, int32_t expectedLandHeight1, int32_t expectedLandHeight2, int32_t stepX,
-    int32_t stepY, int32_t direction1, int32_t direction2, int32_t checkDirection1, int32_t checkDirection2) const
+void LandSmoothAction::SmoothLandRowByEdge(
+    GameActions::NestedActionBatch& batch, const CoordsXY& loc, int32_t expectedLandHeight1, int32_t expectedLandHeight2,
+    int32_t stepX, int32_t stepY, int32_t direction1, int32_t direction2, int32_t checkDirection1,
+    int32_t checkDirection2) const
 {
     uint8_t shouldContinue = 0xF;
     int32_t landChangePerTile = _isLowering ? 2 : -2;
-    money64 totalCost = 0;
 
     // check if we need to start at all
     if (!LocationValid(loc) || !LocationValid({ loc.x + stepX, loc.y + stepY }))
     {
-        return 0;
+        return;
     }
     auto surfaceElement = MapGetSurfaceElementAt(loc);
     auto nextSurfaceElement = MapGetSurfaceElementAt(CoordsXY{ loc.x + stepX, loc.y + stepY });
     if (surfaceElement == nullptr || nextSurfaceElement == nullptr)
     {
-        return 0;
+        return;
     }
     if (TileElementGetCornerHeight(surfaceElement, checkDirection1) != expectedLandHeight1 + landChangePerTile)
     {
@@ -229,22 +227,15 @@ money64 LandSmoothAction::SmoothLandRowByEdge(
         }
         auto landSetHeightAction = LandSetHeightAction(nextLoc, targetBaseZ, slope);
         landSetHeightAction.SetFlags(GetFlags());
-        auto res = isExecuting ? GameActions::ExecuteNested(&landSetHeightAction)
-                               : GameActions::QueryNested(&landSetHeightAction);
-        if (res.Error == GameActions::Status::Ok)
-        {
-            totalCost += res.Cost;
-        }
+        batch.Run(landSetHeightAction);
     }
-    return totalCost;
 }
 
-money64 LandSmoothAction::SmoothLandRowByCorner(
-    bool isExecuting, const CoordsXY& loc, int32_t expectedLandHeight, int32_t stepX, int32_t stepY, int32_t direction,
-    int32_t checkDirection) const
+void LandSmoothAction::SmoothLandRowByCorner(
+    GameActions::NestedActionBatch& batch, const CoordsXY& loc, int32_t expectedLandHeight, int32_t stepX, int32_t stepY,
+    int32_t direction, int32_t checkDirection) const
 {
     bool shouldContinue = true;
-    money64 totalCost = 0;
     int32_t landChangePerTile;
     if (stepX == 0 || stepY == 0)
     {
@@ -258,21 +249,21 @@ money64 LandSmoothAction::SmoothLandRowByCorner(
     // check if we need to start at all
     if (!LocationValid(loc) || !LocationValid({ loc.x + stepX, loc.y + stepY }))
     {
-        return 0;
+        return;
     }
     auto surfaceElement = MapGetSurfaceElementAt(loc);
     auto nextSurfaceElement = MapGetSurfaceElementAt(CoordsXY{ loc.x + stepX, loc.y + stepY });
     if (surfaceElement == nullptr || nextSurfaceElement == nullptr)
     {
-        return 0;
+        return;
     }
     if (TileElementGetCornerHeight(surfaceElement, checkDirection) != expectedLandHeight + (_isLowering ? 2 : -2))
     {
-        return 0;
+        return;
     }
     if (TileElementGetCornerHeight(surfaceElement, checkDirection) != TileElementGetCornerHeight(nextSurfaceElement, direction))
     {
-        return 0;
+        return;
     }
 
     auto nextLoc = loc;
@@ -308,20 +299,15 @@ money64 LandSmoothAction::SmoothLandRowByCorner(
         }
         if (stepX * stepY != 0)
         {
-            totalCost += SmoothLandRowByCorner(
-                isExecuting, nextLoc, expectedLandHeight + (landChangePerTile / 2), 0, stepY, direction, checkDirection ^ 3);
-            totalCost += SmoothLandRowByCorner(
-                isExecuting, nextLoc, expectedLandHeight + (landChangePerTile / 2), stepX, 0, direction, checkDirection ^ 1);
+            SmoothLandRowByCorner(
+                batch, nextLoc, expectedLandHeight + (landChangePerTile / 2), 0, stepY, direction, checkDirection ^ 3);
+            SmoothLandRowByCorner(
+                batch, nextLoc, expectedLandHeight + (landChangePerTile / 2), stepX, 0, direction, checkDirection ^ 1);
         }
         expectedLandHeight += landChangePerTile;
         // change land of current tile
-        auto result = SmoothLandTile(direction, isExecuting, nextLoc, surfaceElement);
-        if (result.Error == GameActions::Status::Ok)
-        {
-            totalCost += result.Cost;
-        }
+        SmoothLandTile(direction, batch, nextLoc, surfaceElement);
     }
-    return totalCost;
 }
 
 GameActions::Result LandSmoothAction::SmoothLand(bool isExecuting) const
@@ -344,6 +330,7 @@ GameActions::Result LandSmoothAction::SmoothLand(bool isExecuting) const
     res.ErrorTitle = _ErrorTitles[_isLowering ? 0 : 1];
     res.Expenditure = ExpenditureType::Landscaping;
     res.Position = { _coords.x, _coords.y, centreZ };
+    GameActions::NestedActionBatch batch(isExecuting);
 
     // Do the smoothing
     switch (selectionType)
@@ -360,8 +347,7 @@ GameActions::Result LandSmoothAction::SmoothLand(bool isExecuting) const
                 {
                     int32_t z = std::clamp(
                         static_cast<uint8_t>(TileElementGetCornerHeight(surfaceElement, 2)), minHeight, maxHeight);
-                    res.Cost += SmoothLandRowByCorner(
-                        isExecuting, { validRange.GetLeft(), validRange.GetTop() }, z, -32, -32, 0, 2);
+                    SmoothLandRowByCorner(batch, { validRange.GetLeft(), validRange.GetTop() }, z, -32, -32, 0, 2);
                 }
             }
             { // bottom-left
@@ -370,8 +356,7 @@ GameActions::Result LandSmoothAction::SmoothLand(bool isExecuting) const
                 {
                     int32_t z = std::clamp(
                         static_cast<uint8_t>(TileElementGetCornerHeight(surfaceElement, 3)), minHeight, maxHeight);
-                    res.Cost += SmoothLandRowByCorner(
-                        isExecuting, { validRange.GetLeft(), validRange.GetBottom() }, z, -32, 32, 1, 3);
+                    SmoothLandRowByCorner(batch, { validRange.GetLeft(), validRange.GetBottom() }, z, -32, 32, 1, 3);
                 }
             }
             { // bottom-right
@@ -380,8 +365,7 @@ GameActions::Result LandSmoothAction::SmoothLand(bool isExecuting) const
                 {
                     int32_t z = std::clamp(
                         static_cast<uint8_t>(TileElementGetCornerHeight(surfaceElement, 0)), minHeight, maxHeight);
-                    res.Cost += SmoothLandRowByCorner(
-                        isExecuting, { validRange.GetRight(), validRange.GetBottom() }, z, 32, 32, 2, 0);
+                    SmoothLandRowByCorner(batch, { validRange.GetRight(), validRange.GetBottom() }, z, 32, 32, 2, 0);
                 }
             }
             { // top-right
@@ -390,8 +374,7 @@ GameActions::Result LandSmoothAction::SmoothLand(bool isExecuting) const
                 {
                     int32_t z = std::clamp(
                         static_cast<uint8_t>(TileElementGetCornerHeight(surfaceElement, 1)), minHeight, maxHeight);
-                    res.Cost += SmoothLandRowByCorner(
-                        isExecuting, { validRange.GetRight(), validRange.GetTop() }, z, 32, -32, 3, 1);
+                    SmoothLandRowByCorner(batch, { validRange.GetRight(), validRange.GetTop() }, z, 32, -32, 3, 1);
                 }
             }
 
@@ -404,7 +387,7 @@ GameActions::Result LandSmoothAction::SmoothLand(bool isExecuting) const
                 {
                     z1 = std::clamp(static_cast<uint8_t>(TileElementGetCornerHeight(surfaceElement, 3)), minHeight, maxHeight);
                     z2 = std::clamp(static_cast<uint8_t>(TileElementGetCornerHeight(surfaceElement, 2)), minHeight, maxHeight);
-                    res.Cost += SmoothLandRowByEdge(isExecuting, { validRange.GetLeft(), y }, z1, z2, -32, 0, 0, 1, 3, 2);
+                    SmoothLandRowByEdge(batch, { validRange.GetLeft(), y }, z1, z2, -32, 0, 0, 1, 3, 2);
                 }
 
                 surfaceElement = MapGetSurfaceElementAt(CoordsXY{ validRange.GetRight(), y });
@@ -412,7 +395,7 @@ GameActions::Result LandSmoothAction::SmoothLand(bool isExecuting) const
                 {
                     z1 = std::clamp(static_cast<uint8_t>(TileElementGetCornerHeight(surfaceElement, 1)), minHeight, maxHeight);
                     z2 = std::clamp(static_cast<uint8_t>(TileElementGetCornerHeight(surfaceElement, 0)), minHeight, maxHeight);
-                    res.Cost += SmoothLandRowByEdge(isExecuting, { validRange.GetRight(), y }, z1, z2, 32, 0, 2, 3, 1, 0);
+                    SmoothLandRowByEdge(batch, { validRange.GetRight(), y }, z1, z2, 32, 0, 2, 3, 1, 0);
                 }
             }
 
@@ -423,7 +406,7 @@ GameActions::Result LandSmoothAction::SmoothLand(bool isExecuting) const
                 {
                     z1 = std::clamp(static_cast<uint8_t>(TileElementGetCornerHeight(surfaceElement, 1)), minHeight, maxHeight);
                     z2 = std::clamp(static_cast<uint8_t>(TileElementGetCornerHeight(surfaceElement, 2)), minHeight, maxHeight);
-                    res.Cost += SmoothLandRowByEdge(isExecuting, { x, validRange.GetTop() }, z1, z2, 0, -32, 0, 3, 1, 2);
+                    SmoothLandRowByEdge(batch, { x, validRange.GetTop() }, z1, z2, 0, -32, 0, 3, 1, 2);
                 }
 
                 surfaceElement = MapGetSurfaceElementAt(CoordsXY{ x, validRange.GetBottom() });
@@ -431,7 +414,7 @@ GameActions::Result LandSmoothAction::SmoothLand(bool isExecuting) const
                 {
                     z1 = std::clamp(static_cast<uint8_t>(TileElementGetCornerHeight(surfaceElement, 0)), minHeight, maxHeight);
                     z2 = std::clamp(static_cast<uint8_t>(TileElementGetCornerHeight(surfaceElement, 3)), minHeight, maxHeight);
-                    res.Cost += SmoothLandRowByEdge(isExecuting, { x, validRange.GetBottom() }, z1, z2, 0, 32, 1, 2, 0, 3);
+                    SmoothLandRowByEdge(batch, { x, validRange.GetBottom() }, z1, z2, 0, 32, 1, 2, 0, 3);
                 }
             }
             break;
@@ -464,68 +447,52 @@ GameActions::Result LandSmoothAction::SmoothLand(bool isExecuting) const
 
             // Smooth the corners
             int32_t z = MapGetCornerHeight(newBaseZ, newSlope, 2);
-            res.Cost += SmoothLandRowByCorner(isExecuting, { validRange.GetLeft(), validRange.GetTop() }, z, -32, -32, 0, 2);
+            SmoothLandRowByCorner(batch, { validRange.GetLeft(), validRange.GetTop() }, z, -32, -32, 0, 2);
             z = MapGetCornerHeight(newBaseZ, newSlope, 0);
-            res.Cost += SmoothLandRowByCorner(isExecuting, { validRange.GetLeft(), validRange.GetTop() }, z, 32, 32, 2, 0);
+            SmoothLandRowByCorner(batch, { validRange.GetLeft(), validRange.GetTop() }, z, 32, 32, 2, 0);
             z = MapGetCornerHeight(newBaseZ, newSlope, 3);
-            res.Cost += SmoothLandRowByCorner(isExecuting, { validRange.GetLeft(), validRange.GetTop() }, z, -32, 32, 1, 3);
+            SmoothLandRowByCorner(batch, { validRange.GetLeft(), validRange.GetTop() }, z, -32, 32, 1, 3);
             z = MapGetCornerHeight(newBaseZ, newSlope, 1);
-            res.Cost += SmoothLandRowByCorner(isExecuting, { validRange.GetLeft(), validRange.GetTop() }, z, 32, -32, 3, 1);
+            SmoothLandRowByCorner(batch, { validRange.GetLeft(), validRange.GetTop() }, z, 32, -32, 3, 1);
 
             // Smooth the edges
             switch (selectionType)
             {
                 case MAP_SELECT_TYPE_CORNER_0:
                     z = MapGetCornerHeight(newBaseZ, newSlope, 0);
-                    res.Cost += SmoothLandRowByCorner(
-                        isExecuting, { validRange.GetLeft(), validRange.GetTop() }, z, 32, 0, 3, 0);
-                    res.Cost += SmoothLandRowByCorner(
-                        isExecuting, { validRange.GetLeft(), validRange.GetTop() }, z, 0, 32, 1, 0);
+                    SmoothLandRowByCorner(batch, { validRange.GetLeft(), validRange.GetTop() }, z, 32, 0, 3, 0);
+                    SmoothLandRowByCorner(batch, { validRange.GetLeft(), validRange.GetTop() }, z, 0, 32, 1, 0);
                     z = MapGetCornerHeight(newBaseZ, newSlope, 3);
-                    res.Cost += SmoothLandRowByCorner(
-                        isExecuting, { validRange.GetLeft(), validRange.GetTop() }, z, -32, 0, 0, 3);
+                    SmoothLandRowByCorner(batch, { validRange.GetLeft(), validRange.GetTop() }, z, -32, 0, 0, 3);
                     z = MapGetCornerHeight(newBaseZ, newSlope, 1);
-                    res.Cost += SmoothLandRowByCorner(
-                        isExecuting, { validRange.GetLeft(), validRange.GetTop() }, z, 0, -32, 0, 1);
+                    SmoothLandRowByCorner(batch, { validRange.GetLeft(), validRange.GetTop() }, z, 0, -32, 0, 1);
                     break;
                 case MAP_SELECT_TYPE_CORNER_1:
                     z = MapGetCornerHeight(newBaseZ, newSlope, 1);
-                    res.Cost += SmoothLandRowByCorner(
-                        isExecuting, { validRange.GetLeft(), validRange.GetTop() }, z, 32, 0, 2, 1);
-                    res.Cost += SmoothLandRowByCorner(
-                        isExecuting, { validRange.GetLeft(), validRange.GetTop() }, z, 0, -32, 0, 1);
+                    SmoothLandRowByCorner(batch, { validRange.GetLeft(), validRange.GetTop() }, z, 32, 0, 2, 1);
+                    SmoothLandRowByCorner(batch, { validRange.GetLeft(), validRange.GetTop() }, z, 0, -32, 0, 1);
                     z = MapGetCornerHeight(newBaseZ, newSlope, 2);
-                    res.Cost += SmoothLandRowByCorner(
-                        isExecuting, { validRange.GetLeft(), validRange.GetTop() }, z, -32, 0, 1, 2);
+                    SmoothLandRowByCorner(batch, { validRange.GetLeft(), validRange.GetTop() }, z, -32, 0, 1, 2);
                     z = MapGetCornerHeight(newBaseZ, newSlope, 0);
-                    res.Cost += SmoothLandRowByCorner(
-                        isExecuting, { validRange.GetLeft(), validRange.GetTop() }, z, 0, 32, 1, 0);
+                    SmoothLandRowByCorner(batch, { validRange.GetLeft(), validRange.GetTop() }, z, 0, 32, 1, 0);
                     break;
                 case MAP_SELECT_TYPE_CORNER_2:
                     z = MapGetCornerHeight(newBaseZ, newSlope, 2);
-                    res.Cost += SmoothLandRowByCorner(
-                        isExecuting, { validRange.GetLeft(), validRange.GetTop() }, z, -32, 0, 1, 2);
-                    res.Cost += SmoothLandRowByCorner(
-                        isExecuting, { validRange.GetLeft(), validRange.GetTop() }, z, 0, -32, 3, 2);
+                    SmoothLandRowByCorner(batch, { validRange.GetLeft(), validRange.GetTop() }, z, -32, 0, 1, 2);
+                    SmoothLandRowByCorner(batch, { validRange.GetLeft(), validRange.GetTop() }, z, 0, -32, 3, 2);
                     z = MapGetCornerHeight(newBaseZ, newSlope, 1);
-                    res.Cost += SmoothLandRowByCorner(
-                        isExecuting, { validRange.GetLeft(), validRange.GetTop() }, z, 32, 0, 2, 1);
+                    SmoothLandRowByCorner(batch, { validRange.GetLeft(), validRange.GetTop() }, z, 32, 0, 2, 1);
                     z = MapGetCornerHeight(newBaseZ, newSlope, 3);
-                    res.Cost += SmoothLandRowByCorner(
-                        isExecuting, { validRange.GetLeft(), validRange.GetTop() }, z, 0, 32, 2, 3);
+                    SmoothLandRowByCorner(batch, { validRange.GetLeft(), validRange.GetTop() }, z, 0, 32, 2, 3);
                     break;
                 case MAP_SELECT_TYPE_CORNER_3:
                     z = MapGetCornerHeight(newBaseZ, newSlope, 3);
-                    res.Cost += SmoothLandRowByCorner(
-                        isExecuting, { validRange.GetLeft(), validRange.GetTop() }, z, -32, 0, 0, 3);
-                    res.Cost += SmoothLandRowByCorner(
-                        isExecuting, { validRange.GetLeft(), validRange.GetTop() }, z, 0, 32, 2, 3);
+                    SmoothLandRowByCorner(batch, { validRange.GetLeft(), validRange.GetTop() }, z, -32, 0, 0, 3);
+                    SmoothLandRowByCorner(batch, { validRange.GetLeft(), validRange.GetTop() }, z, 0, 32, 2, 3);
                     z = MapGetCornerHeight(newBaseZ, newSlope, 0);
-                    res.Cost += SmoothLandRowByCorner(
-                        isExecuting, { validRange.GetLeft(), validRange.GetTop() }, z, 32, 0, 3, 0);
+                    SmoothLandRowByCorner(batch, { validRange.GetLeft(), validRange.GetTop() }, z, 32, 0, 3, 0);
                     z = MapGetCornerHeight(newBaseZ, newSlope, 2);
-                    res.Cost += SmoothLandRowByCorner(
-                        isExecuting, { validRange.GetLeft(), validRange.GetTop() }, z, 0, -32, 3, 2);
+                    SmoothLandRowByCorner(batch, { validRange.GetLeft(), validRange.GetTop() }, z, 0, -32, 3, 2);
                     break;
             }
             break;
@@ -581,29 +548,29 @@ GameActions::Result LandSmoothAction::SmoothLand(bool isExecuting) const
             uint8_t z3 = MapGetCornerHeight(newBaseZ, newSlope, c3);
             uint8_t z4 = MapGetCornerHeight(newBaseZ, newSlope, c4);
             // Smooth the edge at the top of the new slope
-            res.Cost += SmoothLandRowByEdge(
-                isExecuting, { validRange.GetLeft(), validRange.GetTop() }, z1, z2, stepOffsets[edge].x, stepOffsets[edge].y,
+            SmoothLandRowByEdge(
+                batch, { validRange.GetLeft(), validRange.GetTop() }, z1, z2, stepOffsets[edge].x, stepOffsets[edge].y,
                 c3, c4, c1, c2);
             // Smooth the edge at the bottom of the new slope
-            res.Cost += SmoothLandRowByEdge(
-                isExecuting, { validRange.GetLeft(), validRange.GetTop() }, z3, z4, -stepOffsets[edge].x, -stepOffsets[edge].y,
+            SmoothLandRowByEdge(
+                batch, { validRange.GetLeft(), validRange.GetTop() }, z3, z4, -stepOffsets[edge].x, -stepOffsets[edge].y,
                 c1, c2, c3, c4);
 
             // Smooth corners
-            res.Cost += SmoothLandRowByCorner(
-                isExecuting, { validRange.GetLeft(), validRange.GetTop() }, z1, -stepOffsets[edge].y, stepOffsets[edge].x, c2,
+            SmoothLandRowByCorner(
+                batch, { validRange.GetLeft(), validRange.GetTop() }, z1, -stepOffsets[edge].y, stepOffsets[edge].x, c2,
                 c1);
-            res.Cost += SmoothLandRowByCorner(
-                isExecuting, { validRange.GetLeft(), validRange.GetTop() }, z2, stepOffsets[edge].y, -stepOffsets[edge].x, c1,
+            SmoothLandRowByCorner(
+                batch, { validRange.GetLeft(), validRange.GetTop() }, z2, stepOffsets[edge].y, -stepOffsets[edge].x, c1,
                 c2);
             int32_t z = MapGetCornerHeight(newBaseZ, newSlope, 2);
-            res.Cost += SmoothLandRowByCorner(isExecuting, { validRange.GetLeft(), validRange.GetTop() }, z, -32, -32, 0, 2);
+            SmoothLandRowByCorner(batch, { validRange.GetLeft(), validRange.GetTop() }, z, -32, -32, 0, 2);
             z = MapGetCornerHeight(newBaseZ, newSlope, 0);
-            res.Cost += SmoothLandRowByCorner(isExecuting, { validRange.GetLeft(), validRange.GetTop() }, z, 32, 32, 2, 0);
+            SmoothLandRowByCorner(batch, { validRange.GetLeft(), validRange.GetTop() }, z, 32, 32, 2, 0);
             z = MapGetCornerHeight(newBaseZ, newSlope, 3);
-            res.Cost += SmoothLandRowByCorner(isExecuting, { validRange.GetLeft(), validRange.GetTop() }, z, -32, 32, 1, 3);
+            SmoothLandRowByCorner(batch, { validRange.GetLeft(), validRange.GetTop() }, z, -32, 32, 1, 3);
             z = MapGetCornerHeight(newBaseZ, newSlope, 1);
-            res.Cost += SmoothLandRowByCorner(isExecuting, { validRange.GetLeft(), validRange.GetTop() }, z, 32, -32, 3, 1);
+            SmoothLandRowByCorner(batch, { validRange.GetLeft(), validRange.GetTop() }, z, 32, -32, 3, 1);
             break;
         }
         default:
@@ -612,28 +579,28 @@ GameActions::Result LandSmoothAction::SmoothLand(bool isExecuting) const
     } // switch selectionType
 
     // Raise / lower the land tool selection area
-    GameActions::Result result;
+    bool succeeded;
     if (raiseLand)
     {
         auto raiseLandAction = LandRaiseAction({ _coords.x, _coords.y }, validRange, selectionType);
         raiseLandAction.SetFlags(GetFlags());
-        result = isExecuting ? GameActions::ExecuteNested(&raiseLandAction) : GameActions::QueryNested(&raiseLandAction);
+        succeeded = batch.Run(raiseLandAction);
     }
     else
     {
         auto lowerLandAction = LandLowerAction({ _coords.x, _coords.y }, validRange, selectionType);
         lowerLandAction.SetFlags(GetFlags());
-        result = isExecuting ? GameActions::ExecuteNested(&lowerLandAction) : GameActions::QueryNested(&lowerLandAction);
+        succeeded = batch.Run(lowerLandAction);
     }
-    if (result.Error != GameActions::Status::Ok)
+    if (!succeeded)
     {
-        return result;
+        return batch.GetLastFailure();
     }
 
     if (isExecuting)
     {
         OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::PlaceItem, { _coords.x, _coords.y, centreZ });
     }
-    res.Cost += result.Cost;
+    res.Cost = batch.GetCost();
     return res;
 }
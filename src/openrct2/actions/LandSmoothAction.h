@@ -37,13 +37,14 @@ public:
     GameActions::Result Execute() const override;
 
 private:
-    GameActions::Result SmoothLandTile(
-        int32_t direction, bool isExecuting, const CoordsXY& loc, SurfaceElement* surfaceElement) const;
-    money64 SmoothLandRowByEdge(
-        bool isExecuting, const CoordsXY& loc, int32_t expectedLandHeight1, int32_t expectedLandHeight2, int32_t stepX,
-        int32_t stepY, int32_t direction1, int32_t direction2, int32_t checkDirection1, int32_t checkDirection2) const;
-    money64 SmoothLandRowByCorner(
-        bool isExecuting, const CoordsXY& loc, int32_t expectedLandHeight, int32_t stepX, int32_t stepY, int32_t direction,
-        int32_t checkDirection) const;
+    void SmoothLandTile(
+        int32_t direction, GameActions::NestedActionBatch& batch, const CoordsXY& loc, SurfaceElement* surfaceElement) const;
+    void SmoothLandRowByEdge(
+        GameActions::NestedActionBatch& batch, const CoordsXY& loc, int32_t expectedLandHeight1, int32_t expectedLandHeight2,
+        int32_t stepX, int32_t stepY, int32_t direction1, int32_t direction2, int32_t checkDirection1,
+        int32_t checkDirection2) const;
+    void SmoothLandRowByCorner(
+        GameActions::NestedActionBatch& batch, const CoordsXY& loc, int32_t expectedLandHeight, int32_t stepX, int32_t stepY,
+        int32_t direction, int32_t checkDirection) const;
     GameActions::Result SmoothLand(bool isExecuting) const;
 };
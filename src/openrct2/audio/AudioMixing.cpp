@@ -0,0 +1,114 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "AudioMixing.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define OPENRCT2_MIXING_SSE2
+#    include <emmintrin.h>
+#endif
+
+namespace OpenRCT2::Audio
+{
+    void MixS16Scalar(float* bus, const int16_t* src, size_t numFrames, int32_t numChannels, const MixGain& gain)
+    {
+        if (numFrames == 0)
+            return;
+
+        const auto stepL = (gain.EndL - gain.StartL) / static_cast<float>(numFrames);
+        const auto stepR = (gain.EndR - gain.StartR) / static_cast<float>(numFrames);
+        for (size_t i = 0; i < numFrames; i++)
+        {
+            const auto gainL = gain.StartL + stepL * static_cast<float>(i);
+            const auto gainR = gain.StartR + stepR * static_cast<float>(i);
+            for (int32_t c = 0; c < numChannels; c++)
+            {
+                *bus++ += static_cast<float>(*src++) * ((c & 1) ? gainR : gainL);
+            }
+        }
+    }
+
+    void ConvertMixToS16Scalar(int16_t* dst, const float* bus, size_t numSamples)
+    {
+        for (size_t i = 0; i < numSamples; i++)
+        {
+            dst[i] = static_cast<int16_t>(std::clamp(std::nearbyint(bus[i]), -32768.0f, 32767.0f));
+        }
+    }
+
+#ifdef OPENRCT2_MIXING_SSE2
+    // Sign extends four 16-bit samples to floats.
+    static __m128 LoadS16(const int16_t* src)
+    {
+        const auto samples = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src));
+        return _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(samples, samples), 16));
+    }
+
+    void MixS16(float* bus, const int16_t* src, size_t numFrames, int32_t numChannels, const MixGain& gain)
+    {
+        if (numChannels != 2 || numFrames == 0)
+        {
+            MixS16Scalar(bus, src, numFrames, numChannels, gain);
+            return;
+        }
+
+        // Two stereo frames per step, so the gains of frame i and i + 1 are interleaved as L, R, L, R
+        const auto stepL = (gain.EndL - gain.StartL) / static_cast<float>(numFrames);
+        const auto stepR = (gain.EndR - gain.StartR) / static_cast<float>(numFrames);
+        auto gains = _mm_setr_ps(gain.StartL, gain.StartR, gain.StartL + stepL, gain.StartR + stepR);
+        const auto step = _mm_setr_ps(stepL * 2, stepR * 2, stepL * 2, stepR * 2);
+
+        size_t i = 0;
+        for (; i + 4 <= numFrames; i += 4)
+        {
+            const auto samples0 = LoadS16(src + i * 2);
+            const auto samples1 = LoadS16(src + i * 2 + 4);
+            const auto gains1 = _mm_add_ps(gains, step);
+            const auto mix0 = _mm_add_ps(_mm_loadu_ps(bus + i * 2), _mm_mul_ps(samples0, gains));
+            const auto mix1 = _mm_add_ps(_mm_loadu_ps(bus + i * 2 + 4), _mm_mul_ps(samples1, gains1));
+            _mm_storeu_ps(bus + i * 2, mix0);
+            _mm_storeu_ps(bus + i * 2 + 4, mix1);
+            gains = _mm_add_ps(gains1, step);
+        }
+
+        if (i < numFrames)
+        {
+            MixGain remaining{ gain.StartL + stepL * static_cast<float>(i), gain.StartR + stepR * static_cast<float>(i),
+                               gain.EndL, gain.EndR };
+            MixS16Scalar(bus + i * 2, src + i * 2, numFrames - i, numChannels, remaining);
+        }
+    }
+
+    void ConvertMixToS16(int16_t* dst, const float* bus, size_t numSamples)
+    {
+        // _mm_packs_epi32 saturates, which clips the samples
+        size_t i = 0;
+        for (; i + 8 <= numSamples; i += 8)
+        {
+            const auto samples0 = _mm_cvtps_epi32(_mm_loadu_ps(bus + i));
+            const auto samples1 = _mm_cvtps_epi32(_mm_loadu_ps(bus + i + 4));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packs_epi32(samples0, samples1));
+        }
+        ConvertMixToS16Scalar(dst + i, bus + i, numSamples - i);
+    }
+#else
+    void MixS16(float* bus, const int16_t* src, size_t numFrames, int32_t numChannels, const MixGain& gain)
+    {
+        MixS16Scalar(bus, src, numFrames, numChannels, gain);
+    }
+
+    void ConvertMixToS16(int16_t* dst, const float* bus, size_t numSamples)
+    {
+        ConvertMixToS16Scalar(dst, bus, numSamples);
+    }
+#endif
+} // namespace OpenRCT2::Audio
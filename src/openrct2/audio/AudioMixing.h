@@ -0,0 +1,41 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace OpenRCT2::Audio
+{
+    /**
+     * The gain of the left and right channel at the start and at the end of a buffer. The gain is
+     * interpolated between the two for every frame, which fades volume and pan changes in.
+     */
+    struct MixGain
+    {
+        float StartL{};
+        float StartR{};
+        float EndL{};
+        float EndR{};
+    };
+
+    /**
+     * Applies the gain to interleaved 16-bit samples and adds them to a float mix bus. Odd channels
+     * use the right gain, even channels the left gain.
+     */
+    void MixS16(float* bus, const int16_t* src, size_t numFrames, int32_t numChannels, const MixGain& gain);
+    void MixS16Scalar(float* bus, const int16_t* src, size_t numFrames, int32_t numChannels, const MixGain& gain);
+
+    /**
+     * Converts the mix bus to 16-bit samples, clipping samples that are out of range.
+     */
+    void ConvertMixToS16(int16_t* dst, const float* bus, size_t numSamples);
+    void ConvertMixToS16Scalar(int16_t* dst, const float* bus, size_t numSamples);
+} // namespace OpenRCT2::Audio
@@ -0,0 +1,150 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../Context.h"
+#include "../OpenRCT2.h"
+#include "../core/Console.hpp"
+#include "../entity/EntityRegistry.h"
+#include "../entity/Guest.h"
+#include "../util/Util.h"
+#include "../world/Map.h"
+#include "CommandLine.hpp"
+
+#ifdef ENABLE_SCRIPTING
+#    include "../scripting/Duktape.hpp"
+#    include "../scripting/ScriptEngine.h"
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+
+using namespace OpenRCT2;
+
+static int32_t _numGuests = 10000;
+static int32_t _iterations = 10;
+
+// clang-format off
+static constexpr CommandLineOptionDefinition BenchEntityQueryOptionsDef[]
+{
+    { CMDLINE_TYPE_INTEGER, &_numGuests,  NAC, "guests",     "number of guests to create (10000)"   },
+    { CMDLINE_TYPE_INTEGER, &_iterations, NAC, "iterations", "number of times each script runs (10)" },
+    OptionTableEnd
+};
+
+static exitcode_t HandleBenchEntityQuery(CommandLineArgEnumerator* argEnumerator);
+
+const CommandLineCommand CommandLine::BenchEntityQueryCommands[]
+{
+    // Main commands
+    DefineCommand("", "", BenchEntityQueryOptionsDef, HandleBenchEntityQuery),
+    CommandTableEnd
+};
+// clang-format on
+
+#ifdef ENABLE_SCRIPTING
+
+// Both scripts sum the same fields of every guest, so their results can be compared.
+static constexpr const char* PerObjectScript = R"(
+(function() {
+    var sum = 0;
+    var guests = map.getAllEntities("guest");
+    for (var i = 0; i < guests.length; i++) {
+        var guest = guests[i];
+        sum += guest.x + guest.y + guest.z + guest.happiness + guest.energy + guest.cash;
+    }
+    return sum;
+})())";
+
+static constexpr const char* QueryScript = R"(
+(function() {
+    var sum = 0;
+    var guests = map.queryEntities("guest", { fields: ["x", "y", "z", "happiness", "energy", "cash"] });
+    for (var i = 0; i < guests.count; i++) {
+        sum += guests.x[i] + guests.y[i] + guests.z[i] + guests.happiness[i] + guests.energy[i] + guests.cash[i];
+    }
+    return sum;
+})())";
+
+/**
+ * Runs the script the given number of times, returns the best time in milliseconds or a negative value on error.
+ */
+static double RunScript(duk_context* ctx, const char* script, double& result)
+{
+    double bestMs = -1;
+    for (int32_t i = 0; i < std::max(1, _iterations); i++)
+    {
+        const auto start = std::chrono::high_resolution_clock::now();
+        if (duk_peval_string(ctx, script) != DUK_EXEC_SUCCESS)
+        {
+            Console::Error::WriteLine("%s", duk_safe_to_string(ctx, -1));
+            duk_pop(ctx);
+            return -1;
+        }
+        const auto ms = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start)
+                            .count();
+        result = duk_get_number(ctx, -1);
+        duk_pop(ctx);
+
+        bestMs = bestMs < 0 ? ms : std::min(bestMs, ms);
+    }
+    return bestMs;
+}
+
+#endif
+
+static exitcode_t HandleBenchEntityQuery(CommandLineArgEnumerator* argEnumerator)
+{
+#ifdef ENABLE_SCRIPTING
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    UtilSrand(0);
+    const auto mapSizeBig = gMapSize.ToCoordsXY();
+    for (int32_t i = 0; i < _numGuests; i++)
+    {
+        auto* guest = CreateEntity<Guest>();
+        if (guest == nullptr)
+            break;
+
+        guest->Happiness = UtilRand() & 0xFF;
+        guest->Energy = UtilRand() & 0x7F;
+        guest->CashInPocket = UtilRand() % 1000;
+        guest->MoveTo(
+            { static_cast<int32_t>(UtilRand() % mapSizeBig.x), static_cast<int32_t>(UtilRand() % mapSizeBig.y), 16 });
+    }
+
+    auto* ctx = context->GetScriptEngine().GetContext();
+    double perObjectResult = 0;
+    double queryResult = 0;
+    const auto perObjectMs = RunScript(ctx, PerObjectScript, perObjectResult);
+    const auto queryMs = RunScript(ctx, QueryScript, queryResult);
+    if (perObjectMs < 0 || queryMs < 0)
+        return EXITCODE_FAIL;
+
+    Console::WriteLine("getAllEntities: %9.2f ms", perObjectMs);
+    Console::WriteLine("queryEntities:  %9.2f ms (%.1fx)", queryMs, queryMs > 0 ? perObjectMs / queryMs : 0.0);
+    if (perObjectResult != queryResult)
+    {
+        Console::Error::WriteLine("Results differ: %.0f and %.0f", perObjectResult, queryResult);
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+#else
+    Console::Error::WriteLine("OpenRCT2 was built without scripting.");
+    return EXITCODE_FAIL;
+#endif
+}
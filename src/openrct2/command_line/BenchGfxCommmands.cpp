@@ -11,10 +11,12 @@
 #include "CommandLine.hpp"
 
 static exitcode_t HandleBenchGfx(CommandLineArgEnumerator* argEnumerator);
+static exitcode_t HandleBenchGfxDirty(CommandLineArgEnumerator* argEnumerator);
 
 const CommandLineCommand CommandLine::BenchGfxCommands[]{
     // Main commands
-    DefineCommand("", "<file> [iterations count]", nullptr, HandleBenchGfx), CommandTableEnd
+    DefineCommand("", "<file> [iterations count]", nullptr, HandleBenchGfx),
+    DefineCommand("dirty", "<file> [frame count]", nullptr, HandleBenchGfxDirty), CommandTableEnd
 };
 
 static exitcode_t HandleBenchGfx(CommandLineArgEnumerator* argEnumerator)
@@ -28,3 +30,15 @@ static exitcode_t HandleBenchGfx(CommandLineArgEnumerator* argEnumerator)
     }
     return EXITCODE_OK;
 }
+
+static exitcode_t HandleBenchGfxDirty(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = CommandLineForGfxbenchDirty(argv, argc);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
@@ -0,0 +1,146 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../Context.h"
+#include "../OpenRCT2.h"
+#include "../core/Console.hpp"
+#include "../object/DefaultObjects.h"
+#include "../object/ObjectManager.h"
+#include "../util/Util.h"
+#include "../world/Map.h"
+#include "../world/MapGen.h"
+#include "CommandLine.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+
+using namespace OpenRCT2;
+
+static int32_t _seed = 0;
+static int32_t _iterations = 3;
+
+// clang-format off
+static constexpr CommandLineOptionDefinition BenchMapGenOptionsDef[]
+{
+    { CMDLINE_TYPE_INTEGER, &_seed,       NAC, "seed",       "seed for the random number generator (0)" },
+    { CMDLINE_TYPE_INTEGER, &_iterations, NAC, "iterations", "number of times each map size is generated (3)" },
+    OptionTableEnd
+};
+
+static exitcode_t HandleBenchMapGen(CommandLineArgEnumerator* argEnumerator);
+
+const CommandLineCommand CommandLine::BenchMapGenCommands[]
+{
+    // Main commands
+    DefineCommand("", "", BenchMapGenOptionsDef, HandleBenchMapGen),
+    CommandTableEnd
+};
+// clang-format on
+
+static constexpr int32_t MapSizes[] = { 64, 128, 256, 512, MAXIMUM_MAP_SIZE_TECHNICAL };
+
+/**
+ * Hashes the surface of every tile, so that runs with the same seed can be checked for identical output.
+ */
+static uint32_t GetMapChecksum(const TileCoordsXY& mapSize)
+{
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    auto add = [&hash](uint32_t value) {
+        hash ^= value;
+        hash *= 16777619u;
+    };
+    for (int32_t y = 0; y < mapSize.y; y++)
+    {
+        for (int32_t x = 0; x < mapSize.x; x++)
+        {
+            auto* tileElement = MapGetFirstElementAt(TileCoordsXY{ x, y });
+            if (tileElement == nullptr)
+                continue;
+            do
+            {
+                add(EnumValue(tileElement->GetType()));
+                add(tileElement->BaseHeight);
+                add(tileElement->ClearanceHeight);
+                if (auto* surfaceElement = tileElement->AsSurface(); surfaceElement != nullptr)
+                {
+                    add(surfaceElement->GetSlope());
+                    add(surfaceElement->GetWaterHeight());
+                    add(surfaceElement->GetSurfaceStyle());
+                }
+            } while (!(tileElement++)->IsLastForTile());
+        }
+    }
+    return hash;
+}
+
+static exitcode_t HandleBenchMapGen(CommandLineArgEnumerator* argEnumerator)
+{
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    // The map generator only needs the terrain objects
+    auto& objectManager = context->GetObjectManager();
+    for (const auto& entry : MinimumRequiredObjects)
+    {
+        objectManager.LoadObject(entry);
+    }
+
+    const auto iterations = std::max(1, _iterations);
+    for (auto size : MapSizes)
+    {
+        double bestMs = 0;
+        double totalMs = 0;
+        uint32_t checksum = 0;
+        for (int32_t i = 0; i < iterations; i++)
+        {
+            UtilSrand(static_cast<uint32_t>(_seed));
+
+            MapGenSettings settings{};
+            settings.mapSize = { size, size };
+            settings.height = 14;
+            settings.water_level = 8;
+            settings.floor = -1;
+            settings.wall = -1;
+            settings.trees = 1;
+            settings.simplex_low = UtilRand() % 4;
+            settings.simplex_high = 12 + (UtilRand() % (32 - 12));
+            settings.simplex_base_freq = 1.75f;
+            settings.simplex_octaves = 6;
+
+            const auto start = std::chrono::high_resolution_clock::now();
+            MapGenGenerate(&settings);
+            const auto ms = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start)
+                                .count();
+
+            bestMs = i == 0 ? ms : std::min(bestMs, ms);
+            totalMs += ms;
+
+            auto iterationChecksum = GetMapChecksum(settings.mapSize);
+            if (i != 0 && iterationChecksum != checksum)
+            {
+                Console::Error::WriteLine("Map generation is not deterministic for size %d", size);
+                return EXITCODE_FAIL;
+            }
+            checksum = iterationChecksum;
+        }
+
+        Console::WriteLine(
+            "%4dx%-4d best %9.2f ms, average %9.2f ms, checksum %08X", size, size, bestMs, totalMs / iterations, checksum);
+    }
+    return EXITCODE_OK;
+}
@@ -0,0 +1,110 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../audio/AudioMixing.h"
+#include "../core/Console.hpp"
+#include "CommandLine.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace OpenRCT2::Audio;
+
+static int32_t _iterations = 1000;
+
+// clang-format off
+static constexpr CommandLineOptionDefinition BenchMixOptionsDef[]
+{
+    { CMDLINE_TYPE_INTEGER, &_iterations, NAC, "iterations", "number of buffers mixed for each channel count (1000)" },
+    OptionTableEnd
+};
+
+static exitcode_t HandleBenchMix(CommandLineArgEnumerator* argEnumerator);
+
+const CommandLineCommand CommandLine::BenchMixCommands[]
+{
+    // Main commands
+    DefineCommand("", "", BenchMixOptionsDef, HandleBenchMix),
+    CommandTableEnd
+};
+// clang-format on
+
+// The same buffer the audio device is opened with, 2048 stereo frames.
+static constexpr size_t NumFrames = 2048;
+static constexpr int32_t NumChannels = 2;
+static constexpr int32_t ChannelCounts[] = { 1, 8, 32, 128 };
+
+using MixFunc = void (*)(float*, const int16_t*, size_t, int32_t, const MixGain&);
+using ConvertFunc = void (*)(int16_t*, const float*, size_t);
+
+/**
+ * Mixes the channels into a bus and converts it, the same as the mixer does for each audio callback. Returns the
+ * average time per buffer in microseconds.
+ */
+static double MixBuffers(
+    MixFunc mix, ConvertFunc convert, const std::vector<std::vector<int16_t>>& channels, std::vector<int16_t>& output)
+{
+    std::vector<float> bus(NumFrames * NumChannels);
+    const auto iterations = std::max(1, _iterations);
+    const auto start = std::chrono::high_resolution_clock::now();
+    for (int32_t i = 0; i < iterations; i++)
+    {
+        std::fill(bus.begin(), bus.end(), 0.0f);
+        for (size_t c = 0; c < channels.size(); c++)
+        {
+            // Every channel fades its volume and pan, which is the most work for the mixer
+            const auto volume = 1.0f / static_cast<float>(channels.size());
+            const MixGain gain{ volume, volume * 0.5f, volume * 0.5f, volume };
+            mix(bus.data(), channels[c].data(), NumFrames, NumChannels, gain);
+        }
+        convert(output.data(), bus.data(), bus.size());
+    }
+    const auto elapsed = std::chrono::high_resolution_clock::now() - start;
+    return std::chrono::duration<double, std::micro>(elapsed).count() / iterations;
+}
+
+static exitcode_t HandleBenchMix([[maybe_unused]] CommandLineArgEnumerator* argEnumerator)
+{
+    std::mt19937 random(0);
+    std::uniform_int_distribution<int32_t> distribution(-32768, 32767);
+
+    Console::WriteLine("%8s %14s %14s %14s %14s", "channels", "scalar us", "us/channel", "simd us", "us/channel");
+    for (auto numChannels : ChannelCounts)
+    {
+        std::vector<std::vector<int16_t>> channels(numChannels);
+        for (auto& channel : channels)
+        {
+            channel.resize(NumFrames * NumChannels);
+            std::generate(channel.begin(), channel.end(), [&]() { return static_cast<int16_t>(distribution(random)); });
+        }
+
+        std::vector<int16_t> scalarOutput(NumFrames * NumChannels);
+        std::vector<int16_t> output(NumFrames * NumChannels);
+        const auto scalarUs = MixBuffers(MixS16Scalar, ConvertMixToS16Scalar, channels, scalarOutput);
+        const auto us = MixBuffers(MixS16, ConvertMixToS16, channels, output);
+
+        // The gain is stepped differently, so allow the samples to be off by one
+        for (size_t i = 0; i < output.size(); i++)
+        {
+            if (std::abs(output[i] - scalarOutput[i]) > 1)
+            {
+                Console::Error::WriteLine(
+                    "Mix of %d channels differs at sample %zu: %d, expected %d", numChannels, i, output[i], scalarOutput[i]);
+                return EXITCODE_FAIL;
+            }
+        }
+
+        Console::WriteLine(
+            "%8d %14.2f %14.3f %14.2f %14.3f", numChannels, scalarUs, scalarUs / numChannels, us, us / numChannels);
+    }
+    return EXITCODE_OK;
+}
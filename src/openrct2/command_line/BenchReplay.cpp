@@ -0,0 +1,345 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../Context.h"
+#include "../GameState.h"
+#include "../OpenRCT2.h"
+#include "../ReplayManager.h"
+#include "../Version.h"
+#include "../core/Console.hpp"
+#include "../core/File.h"
+#include "../core/FileScanner.h"
+#include "../core/Json.hpp"
+#include "../core/Path.hpp"
+#include "../platform/Platform.h"
+#include "../profiling/Profiling.h"
+#include "../util/Util.h"
+#include "CommandLine.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace OpenRCT2;
+
+static u8string _outputPath;
+static u8string _baselinePath;
+static float _threshold = 10.0f;
+
+// clang-format off
+static constexpr CommandLineOptionDefinition BenchReplayOptionsDef[]
+{
+    { CMDLINE_TYPE_STRING, &_outputPath,   NAC, "output",    "write the results as JSON to the given file"                                },
+    { CMDLINE_TYPE_STRING, &_baselinePath, NAC, "baseline",  "compare the results with a JSON file written by a previous run"              },
+    { CMDLINE_TYPE_REAL,   &_threshold,    NAC, "threshold", "percentage the results may be worse than the baseline before failing (10)" },
+    OptionTableEnd
+};
+
+static exitcode_t HandleBenchReplay(CommandLineArgEnumerator* argEnumerator);
+
+const CommandLineCommand CommandLine::BenchReplayCommands[]
+{
+    // Main commands
+    DefineCommand("", "<file|directory>", BenchReplayOptionsDef, HandleBenchReplay),
+    CommandTableEnd
+};
+// clang-format on
+
+static constexpr size_t NumLogicTimeParts = EnumValue(LogicTimePart::Count);
+
+struct ReplayBenchmarkResult
+{
+    u8string Name;
+    bool Succeeded{};
+    uint32_t Ticks{};
+    double TotalMs{};
+    double MaxTickMs{};
+    std::array<double, NumLogicTimeParts> PartMs{};
+    std::vector<Profiling::MemoryData> Memory;
+
+    double GetTicksPerSecond() const
+    {
+        return TotalMs > 0 ? Ticks / (TotalMs / 1000.0) : 0;
+    }
+};
+
+static std::vector<u8string> GetReplayFiles(const u8string& path)
+{
+    std::vector<u8string> files;
+    if (Path::DirectoryExists(path))
+    {
+        auto scanner = Path::ScanDirectory(Path::Combine(path, u8"*.parkrep"), true);
+        while (scanner->Next())
+        {
+            files.push_back(scanner->GetPath());
+        }
+        std::sort(files.begin(), files.end());
+    }
+    else if (File::Exists(path))
+    {
+        files.push_back(path);
+    }
+    return files;
+}
+
+/**
+ * UpdateLogic reports the time elapsed since the start of the tick after each part, so the time spent in a part is the
+ * difference to the last part that was reported.
+ */
+static void AccumulateLogicTimings(LogicTimings& timings, size_t index, ReplayBenchmarkResult& result)
+{
+    std::chrono::duration<double> previous{};
+    for (size_t i = 0; i < NumLogicTimeParts; i++)
+    {
+        auto& sample = timings.TimingInfo[static_cast<LogicTimePart>(i)][index];
+        if (sample.count() > 0)
+        {
+            result.PartMs[i] += std::chrono::duration<double, std::milli>(sample - previous).count();
+            previous = sample;
+            sample = {};
+        }
+    }
+}
+
+static ReplayBenchmarkResult RunReplay(IContext& context, const u8string& path)
+{
+    ReplayBenchmarkResult result;
+    result.Name = Path::GetFileName(path);
+
+    auto* replayManager = context.GetReplayManager();
+    if (!replayManager->StartPlayback(path))
+    {
+        Console::Error::WriteLine("Unable to start replay: %s", path.c_str());
+        return result;
+    }
+
+    // Resets the allocation counts and peaks so they only cover this replay
+    Profiling::ResetData();
+
+    auto* gameState = context.GetGameState();
+    auto timings = std::make_unique<LogicTimings>();
+    while (replayManager->IsReplaying())
+    {
+        const auto index = timings->CurrentIdx;
+        const auto start = std::chrono::high_resolution_clock::now();
+        gameState->UpdateLogic(timings.get());
+        const auto tickMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start)
+                                .count();
+
+        result.Ticks++;
+        result.TotalMs += tickMs;
+        result.MaxTickMs = std::max(result.MaxTickMs, tickMs);
+        AccumulateLogicTimings(*timings, index, result);
+
+        if (replayManager->IsPlaybackStateMismatching())
+        {
+            Console::Error::WriteLine("Replay state mismatch: %s", path.c_str());
+            replayManager->StopPlayback();
+            result.Memory = Profiling::GetMemoryData();
+            return result;
+        }
+    }
+
+    result.Succeeded = true;
+    result.Memory = Profiling::GetMemoryData();
+    return result;
+}
+
+static json_t ResultToJson(const ReplayBenchmarkResult& result)
+{
+    json_t parts = json_t::object();
+    for (size_t i = 0; i < NumLogicTimeParts; i++)
+    {
+        parts[GetLogicTimePartName(static_cast<LogicTimePart>(i))] = result.PartMs[i];
+    }
+
+    json_t memory = json_t::object();
+    for (const auto& data : result.Memory)
+    {
+        memory[data.Name] = {
+            { "peakBytes", data.PeakBytes },
+            { "allocations", data.AllocationCount },
+        };
+    }
+
+    json_t jsonResult = {
+        { "name", result.Name },
+        { "succeeded", result.Succeeded },
+        { "ticks", result.Ticks },
+        { "totalMs", result.TotalMs },
+        { "maxTickMs", result.MaxTickMs },
+        { "ticksPerSecond", result.GetTicksPerSecond() },
+        { "parts", parts },
+        { "memory", memory },
+    };
+    return jsonResult;
+}
+
+/**
+ * Returns true if value is worse than the baseline by more than the threshold, where larger values are worse.
+ */
+static bool IsRegression(double value, double baseline, double thresholdPercent)
+{
+    return baseline > 0 && value > baseline * (1.0 + thresholdPercent / 100.0);
+}
+
+// Returns the number stored under key, or nullopt if the baseline does not have it, e.g. when it was written by an
+// older build or for a different set of replays.
+static std::optional<double> GetBaselineNumber(const json_t& obj, const std::string& key)
+{
+    if (!obj.is_object() || !obj.contains(key) || !obj[key].is_number())
+        return std::nullopt;
+    return obj[key].get<double>();
+}
+
+static bool CompareWithBaseline(const json_t& results, const json_t& baseline, double thresholdPercent)
+{
+    bool passed = true;
+    const auto baselineReplays = baseline.is_object() ? baseline.value("replays", json_t::array()) : json_t::array();
+    for (const auto& replay : results["replays"])
+    {
+        auto name = replay["name"].get<std::string>();
+        auto it = std::find_if(baselineReplays.begin(), baselineReplays.end(), [&name](const json_t& baselineReplay) {
+            return baselineReplay.is_object() && baselineReplay.value("name", std::string()) == name;
+        });
+        if (it == baselineReplays.end())
+        {
+            Console::WriteLine("%s: not in baseline", name.c_str());
+            continue;
+        }
+
+        // Ticks per second are compared as milliseconds per tick so that larger is worse for every measurement
+        auto ticks = Json::GetNumber<double>(replay["ticks"]);
+        auto baselineTicks = GetBaselineNumber(*it, "ticks");
+        auto baselineTotalMs = GetBaselineNumber(*it, "totalMs");
+        if (!baselineTicks.has_value() || !baselineTotalMs.has_value())
+        {
+            Console::WriteLine("%s: baseline has no ticks or total time", name.c_str());
+            continue;
+        }
+        if (ticks <= 0 || *baselineTicks <= 0)
+            continue;
+
+        auto msPerTick = Json::GetNumber<double>(replay["totalMs"]) / ticks;
+        auto baselineMsPerTick = *baselineTotalMs / *baselineTicks;
+        if (IsRegression(msPerTick, baselineMsPerTick, thresholdPercent))
+        {
+            Console::Error::WriteLine(
+                "%s: regressed from %.4f ms to %.4f ms per tick", name.c_str(), baselineMsPerTick, msPerTick);
+            passed = false;
+        }
+
+        // Parts are only reported to help finding the cause of a regression
+        const auto& parts = replay["parts"];
+        const auto baselineParts = it->value("parts", json_t::object());
+        for (auto part = parts.begin(); part != parts.end(); part++)
+        {
+            auto baselinePartMs = GetBaselineNumber(baselineParts, part.key());
+            if (!baselinePartMs.has_value())
+            {
+                Console::WriteLine("    %s: not in baseline", part.key().c_str());
+                continue;
+            }
+
+            auto partMsPerTick = Json::GetNumber<double>(part.value()) / ticks;
+            auto baselinePartMsPerTick = *baselinePartMs / *baselineTicks;
+            if (IsRegression(partMsPerTick, baselinePartMsPerTick, thresholdPercent))
+            {
+                Console::WriteLine(
+                    "    %s: %.4f ms to %.4f ms per tick", part.key().c_str(), baselinePartMsPerTick, partMsPerTick);
+            }
+        }
+    }
+
+    auto peakMemory = Json::GetNumber<double>(results["peakMemory"]);
+    auto baselinePeakMemory = GetBaselineNumber(baseline, "peakMemory");
+    if (!baselinePeakMemory.has_value())
+    {
+        Console::WriteLine("Peak memory: not in baseline");
+    }
+    else if (IsRegression(peakMemory, *baselinePeakMemory, thresholdPercent))
+    {
+        Console::Error::WriteLine(
+            "Peak memory regressed from %.1f MiB to %.1f MiB", *baselinePeakMemory / (1024 * 1024),
+            peakMemory / (1024 * 1024));
+        passed = false;
+    }
+    return passed;
+}
+
+static exitcode_t HandleBenchReplay(CommandLineArgEnumerator* argEnumerator)
+{
+    const char* inputPath;
+    if (!argEnumerator->TryPopString(&inputPath))
+    {
+        Console::Error::WriteLine("Expected a replay file or a directory of replays.");
+        return EXITCODE_FAIL;
+    }
+
+    auto files = GetReplayFiles(inputPath);
+    if (files.empty())
+    {
+        Console::Error::WriteLine("No replays found in %s", inputPath);
+        return EXITCODE_FAIL;
+    }
+
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+    Profiling::EnableMemoryTracking();
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    bool passed = true;
+    json_t jsonReplays = json_t::array();
+    for (const auto& file : files)
+    {
+        auto result = RunReplay(*context, file);
+        Console::WriteLine(
+            "%s: %u ticks, %.1f ms, %.1f ticks/s, slowest tick %.2f ms%s", result.Name.c_str(), result.Ticks, result.TotalMs,
+            result.GetTicksPerSecond(), result.MaxTickMs, result.Succeeded ? "" : " (FAILED)");
+        passed &= result.Succeeded;
+        jsonReplays.push_back(ResultToJson(result));
+    }
+
+    json_t results = {
+        { "version", std::string(gVersionInfoFull) },
+        { "peakMemory", Platform::GetPeakMemoryUsage() },
+        { "replays", jsonReplays },
+    };
+
+    if (!_outputPath.empty())
+    {
+        Json::WriteToFile(_outputPath, results);
+    }
+
+    if (!_baselinePath.empty())
+    {
+        try
+        {
+            auto baseline = Json::ReadFromFile(_baselinePath);
+            passed &= CompareWithBaseline(results, baseline, _threshold);
+        }
+        catch (const std::exception& e)
+        {
+            Console::Error::WriteLine("Unable to read baseline %s: %s", _baselinePath.c_str(), e.what());
+            return EXITCODE_FAIL;
+        }
+    }
+
+    return passed ? EXITCODE_OK : EXITCODE_FAIL;
+}
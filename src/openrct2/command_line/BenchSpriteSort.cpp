@@ -24,6 +24,7 @@
 #    include "../localisation/Localisation.h"
 #    include "../paint/Paint.h"
 #    include "../platform/Platform.h"
+#    include "../util/Math.hpp"
 #    include "../util/Util.h"
 #    include "../world/Climate.h"
 #    include "../world/Map.h"
@@ -33,6 +34,7 @@
 #    include <benchmark/benchmark.h>
 #    include <cstdint>
 #    include <iterator>
+#    include <string>
 #    include <vector>
 
 static void fixup_pointers(std::vector<RecordedPaintSession>& s)
@@ -68,6 +70,33 @@ static void fixup_pointers(std::vector<RecordedPaintSession>& s)
     }
 }
 
+// Creates a viewport covering the whole map of the loaded park
+static Viewport create_map_viewport()
+{
+    int32_t resolutionWidth = (gMapSize.x * COORDS_XY_STEP * 2);
+    int32_t resolutionHeight = (gMapSize.y * COORDS_XY_STEP * 1);
+
+    resolutionWidth += 8;
+    resolutionHeight += 128;
+
+    Viewport viewport;
+    viewport.pos = { 0, 0 };
+    viewport.width = resolutionWidth;
+    viewport.height = resolutionHeight;
+    viewport.view_width = viewport.width;
+    viewport.view_height = viewport.height;
+    viewport.var_11 = 0;
+    viewport.flags = 0;
+
+    auto customXY = TileCoordsXY(gMapSize.x / 2, gMapSize.y / 2).ToCoordsXY().ToTileCentre();
+    auto customXYZ = CoordsXYZ(customXY, TileElementHeight(customXY));
+    auto screenXY = Translate3DTo2DWithZ(0, customXYZ);
+
+    viewport.viewPos = { screenXY.x - (viewport.view_width / 2), screenXY.y - (viewport.view_height / 2) };
+    viewport.zoom = ZoomLevel{ 0 };
+    return viewport;
+}
+
 static std::vector<RecordedPaintSession> extract_paint_session(std::string_view parkFileName)
 {
     gOpenRCT2Headless = true;
@@ -86,27 +115,9 @@ static std::vector<RecordedPaintSession> extract_paint_session(std::string_view
         gIntroState = IntroState::None;
         gScreenFlags = SCREEN_FLAGS_PLAYING;
 
-        int32_t resolutionWidth = (gMapSize.x * COORDS_XY_STEP * 2);
-        int32_t resolutionHeight = (gMapSize.y * COORDS_XY_STEP * 1);
-
-        resolutionWidth += 8;
-        resolutionHeight += 128;
-
-        Viewport viewport;
-        viewport.pos = { 0, 0 };
-        viewport.width = resolutionWidth;
-        viewport.height = resolutionHeight;
-        viewport.view_width = viewport.width;
-        viewport.view_height = viewport.height;
-        viewport.var_11 = 0;
-        viewport.flags = 0;
-
-        auto customXY = TileCoordsXY(gMapSize.x / 2, gMapSize.y / 2).ToCoordsXY().ToTileCentre();
-        auto customXYZ = CoordsXYZ(customXY, TileElementHeight(customXY));
-        auto screenXY = Translate3DTo2DWithZ(0, customXYZ);
-
-        viewport.viewPos = { screenXY.x - (viewport.view_width / 2), screenXY.y - (viewport.view_height / 2) };
-        viewport.zoom = ZoomLevel{ 0 };
+        Viewport viewport = create_map_viewport();
+        int32_t resolutionWidth = viewport.width;
+        int32_t resolutionHeight = viewport.height;
         gCurrentRotation = 0;
 
         // Ensure sprites appear regardless of rotation
@@ -152,6 +163,65 @@ static void BM_paint_session_arrange(benchmark::State& state, const std::vector<
     delete[] local_s;
 }
 
+// Measures generating the paint structs of the whole map, column by column like ViewportPaint does.
+// Track heavy parks show the cost of the track paint functions here.
+static void BM_paint_session_generate(benchmark::State& state, const std::string& parkFileName)
+{
+    gOpenRCT2Headless = true;
+    auto context = OpenRCT2::CreateContext();
+    if (!context->Initialise())
+    {
+        state.SkipWithError("Context initialization failed.");
+        return;
+    }
+
+    DrawingEngineInit();
+    if (!context->LoadParkFromFile(parkFileName))
+    {
+        state.SkipWithError("Failed to load park!");
+        DrawingEngineDispose();
+        return;
+    }
+
+    gIntroState = IntroState::None;
+    gScreenFlags = SCREEN_FLAGS_PLAYING;
+
+    Viewport viewport = create_map_viewport();
+    gCurrentRotation = 0;
+
+    // Ensure sprites appear regardless of rotation
+    ResetAllSpriteQuadrantPlacements();
+
+    DrawPixelInfo dpi;
+    dpi.x = viewport.viewPos.x;
+    dpi.y = viewport.viewPos.y;
+    dpi.width = viewport.view_width;
+    dpi.height = viewport.view_height;
+    dpi.pitch = 0;
+    dpi.bits = nullptr;
+    dpi.zoom_level = viewport.zoom;
+
+    int64_t numColumns = 0;
+    for (auto _ : state)
+    {
+        for (auto x = Floor2(dpi.x, 32); x < dpi.x + dpi.width; x += 32)
+        {
+            DrawPixelInfo columnDpi = dpi;
+            columnDpi.x = x;
+            columnDpi.width = 32;
+
+            PaintSession* session = PaintSessionAlloc(columnDpi, viewport.flags);
+            PaintSessionGenerate(*session);
+            benchmark::DoNotOptimize(session->LastPS);
+            PaintSessionFree(session);
+            numColumns++;
+        }
+    }
+    state.SetItemsProcessed(numColumns);
+
+    DrawingEngineDispose();
+}
+
 static int command_line_for_bench_sprite_sort(int argc, const char** argv)
 {
     {
@@ -184,6 +254,9 @@ static int command_line_for_bench_sprite_sort(int argc, const char** argv)
             std::vector<RecordedPaintSession> sessions = extract_paint_session(argv[i]);
             if (!sessions.empty())
                 benchmark::RegisterBenchmark(argv[i], BM_paint_session_arrange, sessions);
+
+            auto generateName = std::string(argv[i]) + "/generate";
+            benchmark::RegisterBenchmark(generateName.c_str(), BM_paint_session_generate, std::string(argv[i]));
         }
         else
         {
@@ -87,8 +87,31 @@ static void BM_update(benchmark::State& state, const std::string& filename)
     }
 }
 
+// Measures the start up of a headless instance without graphics, as used by dedicated servers
+static void BM_initialise(benchmark::State& state)
+{
+    const auto noGraphics = gOpenRCT2NoGraphics;
+    gOpenRCT2NoGraphics = true;
+    for (auto _ : state)
+    {
+        std::unique_ptr<IContext> context(CreateContext());
+        if (!context->Initialise())
+        {
+            state.SkipWithError("Context initialization failed.");
+            break;
+        }
+    }
+    gOpenRCT2NoGraphics = noGraphics;
+
+    // This benchmark is registered first so the peak is not affected by the other benchmarks
+    state.counters["PeakMemory_MiB"] = Platform::GetPeakMemoryUsage() / (1024.0 * 1024.0);
+}
+
 static int CommandLineForBenchSpriteSort(int argc, const char* const* argv)
 {
+    // Add a start up test for headless instances
+    benchmark::RegisterBenchmark("initialise", BM_initialise);
+
     // Add a baseline test on an empty park
     benchmark::RegisterBenchmark("baseline", BM_update, std::string{});
 
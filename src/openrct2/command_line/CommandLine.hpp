@@ -119,8 +119,13 @@ namespace CommandLine
     extern const CommandLineCommand BenchGfxCommands[];
     extern const CommandLineCommand BenchSpriteSortCommands[];
     extern const CommandLineCommand BenchUpdateCommands[];
+    extern const CommandLineCommand BenchReplayCommands[];
+    extern const CommandLineCommand BenchMapGenCommands[];
+    extern const CommandLineCommand BenchEntityQueryCommands[];
+    extern const CommandLineCommand BenchMixCommands[];
     extern const CommandLineCommand SimulateCommands[];
     extern const CommandLineCommand ParkInfoCommands[];
+    extern const CommandLineCommand RateTracksCommands[];
 
     extern const CommandLineExample RootExamples[];
 
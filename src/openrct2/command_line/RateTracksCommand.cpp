@@ -0,0 +1,191 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../Context.h"
+#include "../OpenRCT2.h"
+#include "../core/Console.hpp"
+#include "../core/File.h"
+#include "../core/FileScanner.h"
+#include "../core/JobPool.h"
+#include "../core/Json.hpp"
+#include "../core/Path.hpp"
+#include "../ride/TrackDesign.h"
+#include "../ride/TrackDesignRatingsCache.h"
+#include "CommandLine.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <vector>
+
+using namespace OpenRCT2;
+
+static u8string _outputPath;
+static bool _noCache = false;
+
+// clang-format off
+static constexpr CommandLineOptionDefinition RateTracksOptionsDef[]
+{
+    { CMDLINE_TYPE_STRING, &_outputPath, NAC, "output",   "write the ratings as JSON to the given file"         },
+    { CMDLINE_TYPE_SWITCH, &_noCache,    NAC, "no-cache", "calculate every design even if it was rated before" },
+    OptionTableEnd
+};
+
+static exitcode_t HandleRateTracks(CommandLineArgEnumerator* argEnumerator);
+
+const CommandLineCommand CommandLine::RateTracksCommands[]
+{
+    // Main commands
+    DefineCommand("", "<file|directory>", RateTracksOptionsDef, HandleRateTracks),
+    CommandTableEnd
+};
+// clang-format on
+
+struct TrackRatingsResult
+{
+    u8string Path;
+    u8string Hash;
+    std::optional<RatingTuple> Ratings;
+    bool Cached{};
+};
+
+static std::vector<u8string> GetTrackDesignFiles(const u8string& path)
+{
+    std::vector<u8string> files;
+    if (Path::DirectoryExists(path))
+    {
+        auto scanner = Path::ScanDirectory(Path::Combine(path, u8"*.td4;*.td6"), true);
+        while (scanner->Next())
+        {
+            files.push_back(scanner->GetPath());
+        }
+        std::sort(files.begin(), files.end());
+    }
+    else if (File::Exists(path))
+    {
+        files.push_back(path);
+    }
+    return files;
+}
+
+static json_t ResultToJson(const TrackRatingsResult& result)
+{
+    json_t jsonResult = {
+        { "path", result.Path },
+        { "hash", result.Hash },
+    };
+    if (result.Ratings.has_value())
+    {
+        // Designs do not store every measurement the ratings use, see TrackDesignEstimateRatings
+        jsonResult["estimated"] = true;
+        jsonResult["excitement"] = result.Ratings->Excitement;
+        jsonResult["intensity"] = result.Ratings->Intensity;
+        jsonResult["nausea"] = result.Ratings->Nausea;
+    }
+    return jsonResult;
+}
+
+static exitcode_t HandleRateTracks(CommandLineArgEnumerator* argEnumerator)
+{
+    const char* inputPath;
+    if (!argEnumerator->TryPopString(&inputPath))
+    {
+        Console::Error::WriteLine("Expected a track design or a directory of track designs.");
+        return EXITCODE_FAIL;
+    }
+
+    auto files = GetTrackDesignFiles(inputPath);
+    if (files.empty())
+    {
+        Console::Error::WriteLine("No track designs found in %s", inputPath);
+        return EXITCODE_FAIL;
+    }
+
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    // Loads the objects of each design before it is placed, like the track designs manager does
+    gScreenFlags = SCREEN_FLAGS_TRACK_MANAGER;
+
+    std::vector<TrackRatingsResult> results(files.size());
+    for (size_t i = 0; i < files.size(); i++)
+    {
+        results[i].Path = files[i];
+    }
+
+    // Reading and hashing the files does not touch any game state, so it is spread over all cores
+    {
+        JobPool jobPool;
+        for (auto& result : results)
+        {
+            jobPool.AddTask([&result]() { result.Hash = TrackDesignGetFileHash(result.Path); });
+        }
+        jobPool.Join();
+    }
+
+    // Importing a design loads its objects and placing it uses the ride list and the active map, so the designs are
+    // rated one at a time
+    size_t numFailed = 0;
+    for (auto& result : results)
+    {
+        if (!_noCache && !result.Hash.empty())
+        {
+            result.Ratings = TrackDesignRatingsCache::Get(result.Hash);
+            result.Cached = result.Ratings.has_value();
+        }
+
+        if (!result.Cached)
+        {
+            auto td6 = TrackDesignImport(result.Path.c_str());
+            if (td6 != nullptr)
+            {
+                result.Ratings = TrackDesignEstimateRatings(td6.get());
+            }
+            if (result.Ratings.has_value() && !result.Hash.empty())
+            {
+                TrackDesignRatingsCache::Set(result.Hash, *result.Ratings);
+            }
+        }
+
+        auto name = Path::GetFileName(result.Path);
+        if (result.Ratings.has_value())
+        {
+            Console::WriteLine(
+                "%s: estimated excitement %.2f, intensity %.2f, nausea %.2f%s", name.c_str(),
+                result.Ratings->Excitement / 100.0, result.Ratings->Intensity / 100.0, result.Ratings->Nausea / 100.0,
+                result.Cached ? " (cached)" : "");
+        }
+        else
+        {
+            Console::Error::WriteLine("%s: unable to rate design", name.c_str());
+            numFailed++;
+        }
+    }
+    TrackDesignRatingsCache::Flush();
+
+    if (!_outputPath.empty())
+    {
+        json_t jsonResults = json_t::array();
+        for (const auto& result : results)
+        {
+            jsonResults.push_back(ResultToJson(result));
+        }
+        Json::WriteToFile(_outputPath, jsonResults);
+    }
+
+    Console::WriteLine("Rated %zu of %zu track designs", results.size() - numFailed, results.size());
+    return numFailed == 0 ? EXITCODE_OK : EXITCODE_FAIL;
+}
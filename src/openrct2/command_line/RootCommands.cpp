@@ -24,9 +24,11 @@
 #include "../park/ParkFile.h"
 #include "../platform/Crash.h"
 #include "../platform/Platform.h"
+#include "../profiling/Profiling.h"
 #include "../scripting/ScriptEngine.h"
 #include "CommandLine.hpp"
 
+#include <algorithm>
 #include <ctime>
 #include <iterator>
 #include <string>
@@ -60,6 +62,8 @@ static u8string _openrct2DataPath = {};
 static u8string _rct1DataPath = {};
 static u8string _rct2DataPath = {};
 static bool _silentBreakpad = false;
+static u8string _profilerTrace = {};
+static int32_t _profilerTraceTicks = 400;
 
 // clang-format off
 static constexpr CommandLineOptionDefinition StandardOptions[]
@@ -80,6 +84,8 @@ static constexpr CommandLineOptionDefinition StandardOptions[]
     { CMDLINE_TYPE_STRING,  &_openrct2DataPath, NAC, "openrct2-data-path", "path to the OpenRCT2 data directory (containing languages)" },
     { CMDLINE_TYPE_STRING,  &_rct1DataPath,     NAC, "rct1-data-path",     "path to the RollerCoaster Tycoon 1 data directory (containing data/csg1.dat)" },
     { CMDLINE_TYPE_STRING,  &_rct2DataPath,     NAC, "rct2-data-path",     "path to the RollerCoaster Tycoon 2 data directory (containing data/g1.dat)" },
+    { CMDLINE_TYPE_STRING,  &_profilerTrace,    NAC, "profiler-trace",     "write a profiler trace of the first ticks to the given file" },
+    { CMDLINE_TYPE_INTEGER, &_profilerTraceTicks, NAC, "profiler-trace-ticks", "number of ticks to trace (default 400)"                  },
 #ifdef USE_BREAKPAD
     { CMDLINE_TYPE_SWITCH,  &_silentBreakpad,  NAC, "silent-breakpad",   "make breakpad crash reporting silent"                       },
 #endif // USE_BREAKPAD
@@ -143,8 +149,13 @@ const CommandLineCommand CommandLine::RootCommands[]
     DefineSubCommand("benchgfx",        CommandLine::BenchGfxCommands         ),
     DefineSubCommand("benchspritesort", CommandLine::BenchSpriteSortCommands  ),
     DefineSubCommand("benchsimulate",   CommandLine::BenchUpdateCommands      ),
+    DefineSubCommand("benchreplay",     CommandLine::BenchReplayCommands      ),
+    DefineSubCommand("benchmapgen",     CommandLine::BenchMapGenCommands      ),
+    DefineSubCommand("benchentityquery", CommandLine::BenchEntityQueryCommands ),
+    DefineSubCommand("benchmix",        CommandLine::BenchMixCommands         ),
     DefineSubCommand("simulate",        CommandLine::SimulateCommands         ),
     DefineSubCommand("parkinfo",        CommandLine::ParkInfoCommands         ),
+    DefineSubCommand("ratetracks",      CommandLine::RateTracksCommands       ),
     CommandTableEnd
 };
 
@@ -225,6 +236,11 @@ exitcode_t CommandLine::HandleCommandDefault()
         gCustomPassword = _password;
     }
 
+    if (!_profilerTrace.empty())
+    {
+        OpenRCT2::Profiling::StartTrace(std::max(_profilerTraceTicks, 1), Path::GetAbsolute(_profilerTrace));
+    }
+
     return result;
 }
 
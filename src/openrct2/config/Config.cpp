@@ -202,6 +202,7 @@ namespace Config
             model->WindowScale = reader->GetFloat("window_scale", Platform::GetDefaultScale());
             model->ShowFPS = reader->GetBoolean("show_fps", false);
             model->MultiThreading = reader->GetBoolean("multi_threading", false);
+            model->ParallelRideRatings = reader->GetBoolean("parallel_ride_ratings", false);
             model->TrapCursor = reader->GetBoolean("trap_cursor", false);
             model->AutoOpenShops = reader->GetBoolean("auto_open_shops", false);
             model->ScenarioSelectMode = reader->GetInt32("scenario_select_mode", SCENARIO_SELECT_MODE_ORIGIN);
@@ -287,6 +288,7 @@ namespace Config
         writer->WriteFloat("window_scale", model->WindowScale);
         writer->WriteBoolean("show_fps", model->ShowFPS);
         writer->WriteBoolean("multi_threading", model->MultiThreading);
+        writer->WriteBoolean("parallel_ride_ratings", model->ParallelRideRatings);
         writer->WriteBoolean("trap_cursor", model->TrapCursor);
         writer->WriteBoolean("auto_open_shops", model->AutoOpenShops);
         writer->WriteInt32("scenario_select_mode", model->ScenarioSelectMode);
@@ -436,6 +438,7 @@ namespace Config
             model->LogServerActions = reader->GetBoolean("log_server_actions", false);
             model->PauseServerIfNoClients = reader->GetBoolean("pause_server_if_no_clients", false);
             model->DesyncDebugging = reader->GetBoolean("desync_debugging", false);
+            model->TickBudget = reader->GetInt32("tick_budget", 0);
         }
     }
 
@@ -463,6 +466,7 @@ namespace Config
         writer->WriteBoolean("log_server_actions", model->LogServerActions);
         writer->WriteBoolean("pause_server_if_no_clients", model->PauseServerIfNoClients);
         writer->WriteBoolean("desync_debugging", model->DesyncDebugging);
+        writer->WriteInt32("tick_budget", model->TickBudget);
     }
 
     static void ReadNotifications(IIniReader* reader)
@@ -564,6 +568,8 @@ namespace Config
             auto model = &gConfigPlugin;
             model->EnableHotReloading = reader->GetBoolean("enable_hot_reloading", false);
             model->AllowedHosts = reader->GetString("allowed_hosts", "");
+            model->SoftTimeBudget = reader->GetInt32("soft_time_budget", 0);
+            model->HardTimeBudget = reader->GetInt32("hard_time_budget", 0);
         }
     }
 
@@ -573,6 +579,8 @@ namespace Config
         writer->WriteSection("plugin");
         writer->WriteBoolean("enable_hot_reloading", model->EnableHotReloading);
         writer->WriteString("allowed_hosts", model->AllowedHosts);
+        writer->WriteInt32("soft_time_budget", model->SoftTimeBudget);
+        writer->WriteInt32("hard_time_budget", model->HardTimeBudget);
     }
 
     static bool SetDefaults()
@@ -43,6 +43,7 @@ struct GeneralConfiguration
     bool UseVSync;
     bool ShowFPS;
     bool MultiThreading;
+    bool ParallelRideRatings;
     bool MinimizeFullscreenFocusLoss;
     bool DisableScreensaver;
 
@@ -173,6 +174,7 @@ struct NetworkConfiguration
     bool LogServerActions;
     bool PauseServerIfNoClients;
     bool DesyncDebugging;
+    int32_t TickBudget;
 };
 
 struct NotificationConfiguration
@@ -219,6 +221,8 @@ struct PluginConfiguration
 {
     bool EnableHotReloading;
     u8string AllowedHosts;
+    int32_t SoftTimeBudget;
+    int32_t HardTimeBudget;
 };
 
 enum class Sort : int32_t
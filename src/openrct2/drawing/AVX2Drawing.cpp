@@ -42,6 +42,58 @@ void MaskAvx2(
     }
 }
 
+void BlitRleRunAvx2(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t numPixels, int32_t zoomShift, const PaletteMap* paletteMap)
+{
+    // Runs are at most 127 pixels long, so only zoom levels 0 and 1 can fill a 32 pixel vector
+    if (zoomShift <= 1)
+    {
+        const int32_t stepPixels = 32 << zoomShift;
+        const __m256i zero = {};
+        const __m256i mask = _mm256_set1_epi16(0x00FF);
+        while (numPixels >= stepPixels)
+        {
+            const auto* src256 = reinterpret_cast<const __m256i*>(src);
+            __m256i colour;
+            if (zoomShift == 0)
+            {
+                colour = _mm256_loadu_si256(src256);
+            }
+            else
+            {
+                // Packing works within each 128 bit lane, so put the 64 bit halves back in order afterwards
+                const __m256i a = _mm256_and_si256(_mm256_loadu_si256(src256), mask);
+                const __m256i b = _mm256_and_si256(_mm256_loadu_si256(src256 + 1), mask);
+                colour = _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8);
+            }
+
+            __m256i transparent = _mm256_cmpeq_epi8(colour, zero);
+            if (paletteMap != nullptr)
+            {
+                // There is no byte gather, so the remap itself stays scalar
+                alignas(32) uint8_t remapped[32];
+                _mm256_store_si256(reinterpret_cast<__m256i*>(remapped), colour);
+                for (auto& pixel : remapped)
+                {
+                    pixel = (*paletteMap)[pixel];
+                }
+                colour = _mm256_load_si256(reinterpret_cast<const __m256i*>(remapped));
+                transparent = _mm256_or_si256(transparent, _mm256_cmpeq_epi8(colour, zero));
+            }
+
+            const __m256i dest = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_blendv_epi8(colour, dest, transparent));
+
+            src += stepPixels;
+            dst += 32;
+            numPixels -= stepPixels;
+        }
+    }
+
+    // Every CPU with AVX2 also has SSE4.1, which handles what is left in smaller steps
+    BlitRleRunSse4_1(src, dst, numPixels, zoomShift, paletteMap);
+}
+
 #else
 
 #    ifdef OPENRCT2_X86
@@ -55,4 +107,10 @@ void MaskAvx2(
     openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
 }
 
+void BlitRleRunAvx2(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t numPixels, int32_t zoomShift, const PaletteMap* paletteMap)
+{
+    openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
+}
+
 #endif // __AVX2__
@@ -8,6 +8,7 @@
  *****************************************************************************/
 
 #include "Drawing.h"
+#include "MinifiedSpriteCache.h"
 
 #include <algorithm>
 #include <cstring>
@@ -166,6 +167,15 @@ static void FASTCALL DrawRLESpriteMinify(DrawPixelInfo& dpi, const DrawSpriteArg
             else
             {
                 auto& paletteMap = args.PalMap;
+                if constexpr ((TBlendOp & BLEND_DST) == 0)
+                {
+                    // Runs long enough to fill a vector are copied and remapped by the SIMD kernels
+                    if (numPixels >= (16 << TZoom))
+                    {
+                        BlitRleRunFn(src, dst, numPixels, TZoom, (TBlendOp & BLEND_SRC) != 0 ? &paletteMap : nullptr);
+                        continue;
+                    }
+                }
                 while (numPixels > 0)
                 {
                     BlitPixel<TBlendOp>(src, dst, paletteMap);
@@ -207,13 +217,27 @@ template<DrawBlendOp TBlendOp> static void FASTCALL DrawRLESprite(DrawPixelInfo&
     }
 }
 
-/**
- * Transfers readied images onto buffers
- * This function copies the sprite data onto the screen
- *  rct2: 0x0067AA18
- * @param imageId Only flags are used.
- */
-void FASTCALL GfxRleSpriteToBuffer(DrawPixelInfo& dpi, const DrawSpriteArgs& args)
+void BlitRleRunScalar(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t numPixels, int32_t zoomShift, const PaletteMap* paletteMap)
+{
+    const int32_t zoom = 1 << zoomShift;
+    if (paletteMap != nullptr)
+    {
+        for (; numPixels > 0; numPixels -= zoom, src += zoom, dst++)
+        {
+            BlitPixel<BLEND_TRANSPARENT | BLEND_SRC>(src, dst, *paletteMap);
+        }
+    }
+    else
+    {
+        for (; numPixels > 0; numPixels -= zoom, src += zoom, dst++)
+        {
+            BlitPixel<BLEND_TRANSPARENT>(src, dst, PaletteMap::GetDefault());
+        }
+    }
+}
+
+static void DrawRLESpriteWithBlendOp(DrawPixelInfo& dpi, const DrawSpriteArgs& args)
 {
     if (args.Image.HasPrimary())
     {
@@ -235,3 +259,68 @@ void FASTCALL GfxRleSpriteToBuffer(DrawPixelInfo& dpi, const DrawSpriteArgs& arg
         DrawRLESprite<BLEND_TRANSPARENT>(dpi, args);
     }
 }
+
+/**
+ * Draws the cached variant of the sprite with the skipped pixels already removed, as if it was drawn at zoom level 0.
+ * Returns false if the sprite is not cached.
+ */
+static bool DrawMinifiedRLESprite(DrawPixelInfo& dpi, const DrawSpriteArgs& args)
+{
+    const int32_t zoomShift = static_cast<int8_t>(dpi.zoom_level);
+    const int32_t zoom = 1 << zoomShift;
+    auto srcY = args.SrcY;
+    auto height = args.Height;
+    auto dst = args.DestinationBits;
+    const auto dstLineWidth = (static_cast<size_t>(dpi.width) >> zoomShift) + dpi.pitch;
+
+    // Same as DrawRLESpriteMinify
+    if (srcY < 0)
+    {
+        srcY += zoom;
+        height -= zoom;
+        dst += dstLineWidth;
+    }
+
+    const auto phaseX = args.SrcX & (zoom - 1);
+    const auto phaseY = srcY & (zoom - 1);
+    auto sprite = MinifiedSpriteCache::Get(args.Image.GetIndex(), args.SourceImage, zoomShift, phaseX, phaseY);
+    if (sprite == nullptr)
+    {
+        return false;
+    }
+    if (height <= 0)
+    {
+        return true;
+    }
+
+    G1Element g1 = args.SourceImage;
+    g1.offset = const_cast<uint8_t*>(sprite->Data.data());
+    g1.width = sprite->Width;
+    g1.height = sprite->Height;
+
+    DrawPixelInfo minifiedDpi = dpi;
+    minifiedDpi.width = dpi.width >> zoomShift;
+    minifiedDpi.zoom_level = ZoomLevel{ 0 };
+
+    // Rounding down keeps the same pixels as the skipping in DrawRLESpriteMinify
+    DrawSpriteArgs minifiedArgs(
+        args.Image, args.PalMap, g1, args.SrcX >> zoomShift, srcY >> zoomShift, (args.Width + zoom - 1) >> zoomShift,
+        (height + zoom - 1) >> zoomShift, dst);
+    DrawRLESpriteWithBlendOp(minifiedDpi, minifiedArgs);
+    return true;
+}
+
+/**
+ * Transfers readied images onto buffers
+ * This function copies the sprite data onto the screen
+ *  rct2: 0x0067AA18
+ * @param imageId Only flags are used.
+ */
+void FASTCALL GfxRleSpriteToBuffer(DrawPixelInfo& dpi, const DrawSpriteArgs& args)
+{
+    if (dpi.zoom_level > ZoomLevel{ 0 } && DrawMinifiedRLESprite(dpi, args))
+    {
+        return;
+    }
+    DrawRLESpriteWithBlendOp(dpi, args);
+}
@@ -20,6 +20,7 @@
 #include "../sprites.h"
 #include "../ui/UiContext.h"
 #include "../util/Util.h"
+#include "MinifiedSpriteCache.h"
 #include "ScrollingText.h"
 
 #include <algorithm>
@@ -243,6 +244,7 @@ bool GfxLoadG1(const IPlatformEnvironment& env)
 
 void GfxUnloadG1()
 {
+    MinifiedSpriteCache::Clear();
     _g1.data.reset();
     _g1.elements.clear();
     _g1.elements.shrink_to_fit();
@@ -781,6 +783,12 @@ void GfxSetG1Element(ImageIndex imageId, const G1Element* g1)
         }
         else if (isValid)
         {
+            // The new pixels may have been allocated where the old ones were, so the cache cannot tell them apart.
+            // Scrolling text is never cached.
+            if (imageId < SPR_SCROLLING_TEXT_START || imageId >= SPR_SCROLLING_TEXT_END)
+            {
+                MinifiedSpriteCache::Invalidate(imageId, 1);
+            }
             if (imageId < SPR_RCTC_G1_END)
             {
                 if (imageId < static_cast<ImageIndex>(_g1.elements.size()))
@@ -737,6 +737,33 @@ void MaskFn(
     MaskFunc(width, height, maskSrc, colourSrc, dst, maskWrap, colourWrap, dstWrap);
 }
 
+static auto GetBlitRleRunFunction()
+{
+    if (AVX2Available())
+    {
+        LOG_VERBOSE("registering AVX2 RLE run function");
+        return BlitRleRunAvx2;
+    }
+    else if (SSE41Available())
+    {
+        LOG_VERBOSE("registering SSE4.1 RLE run function");
+        return BlitRleRunSse4_1;
+    }
+    else
+    {
+        LOG_VERBOSE("registering scalar RLE run function");
+        return BlitRleRunScalar;
+    }
+}
+
+static const auto BlitRleRunFunc = GetBlitRleRunFunction();
+
+void BlitRleRunFn(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t numPixels, int32_t zoomShift, const PaletteMap* paletteMap)
+{
+    BlitRleRunFunc(src, dst, numPixels, zoomShift, paletteMap);
+}
+
 void GfxFilterPixel(DrawPixelInfo& dpi, const ScreenCoordsXY& coords, FilterPaletteID palette)
 {
     GfxFilterRect(dpi, { coords, coords }, palette);
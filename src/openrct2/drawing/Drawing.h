@@ -602,6 +602,18 @@ void MaskFn(
     int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc, uint8_t* RESTRICT dst,
     int32_t maskWrap, int32_t colourWrap, int32_t dstWrap);
 
+// Blits every (1 << zoomShift)th pixel of numPixels pixels from a run of an RLE sprite, remapping them through paletteMap
+// when it is not nullptr. Pixels that are 0 before or after remapping are transparent.
+void BlitRleRunScalar(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t numPixels, int32_t zoomShift, const PaletteMap* paletteMap);
+void BlitRleRunSse4_1(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t numPixels, int32_t zoomShift, const PaletteMap* paletteMap);
+void BlitRleRunAvx2(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t numPixels, int32_t zoomShift, const PaletteMap* paletteMap);
+
+void BlitRleRunFn(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t numPixels, int32_t zoomShift, const PaletteMap* paletteMap);
+
 std::optional<uint32_t> GetPaletteG1Index(colour_t paletteId);
 std::optional<PaletteMap> GetPaletteMapForColour(colour_t paletteId);
 void UpdatePalette(const uint8_t* colours, int32_t start_index, int32_t num_colours);
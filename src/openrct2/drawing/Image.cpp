@@ -14,6 +14,7 @@
 #include "../core/Guard.hpp"
 #include "../sprites.h"
 #include "Drawing.h"
+#include "MinifiedSpriteCache.h"
 
 #include <algorithm>
 #include <list>
@@ -225,6 +226,7 @@ void GfxObjectFreeImages(uint32_t baseImageId, uint32_t count)
             DrawingEngineInvalidateImage(imageId);
         }
 
+        MinifiedSpriteCache::Invalidate(baseImageId, count);
         FreeImageList(baseImageId, count);
     }
 }
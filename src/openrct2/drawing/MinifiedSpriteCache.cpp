@@ -0,0 +1,297 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "MinifiedSpriteCache.h"
+
+#include "../sprites.h"
+#include "Drawing.h"
+
+#include <array>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace MinifiedSpriteCache
+{
+    constexpr size_t Capacity = 32 * 1024 * 1024;
+
+    // Smaller sprites are quicker to draw than to look up.
+    constexpr int32_t MinSpriteArea = 32 * 32;
+
+    // Sprites are drawn from several threads at once, so the cache is split into shards that each have their own lock.
+    constexpr size_t NumShards = 16;
+
+    // Zoom levels 1 to 3 are cached, each has a variant for every phase modulo its zoom factor.
+    constexpr int32_t MaxZoomShift = 3;
+
+    using Key = uint64_t;
+
+    struct Shard
+    {
+        std::mutex Mutex;
+        // Most recently used first.
+        std::list<std::pair<Key, std::shared_ptr<const MinifiedSprite>>> Entries;
+        std::unordered_map<Key, decltype(Entries)::iterator> Lookup;
+        size_t Size{};
+        uint64_t Hits{};
+        uint64_t Misses{};
+        uint64_t Evictions{};
+    };
+
+    static std::array<Shard, NumShards> _shards;
+
+    static Key GetKey(ImageIndex index, int32_t zoomShift, int32_t phaseX, int32_t phaseY)
+    {
+        return (static_cast<Key>(index) << 8) | (zoomShift << 6) | (phaseX << 3) | phaseY;
+    }
+
+    static ImageIndex GetIndex(Key key)
+    {
+        return static_cast<ImageIndex>(key >> 8);
+    }
+
+    static Shard& GetShard(Key key)
+    {
+        // Neighbouring images are usually drawn together, spread them over the shards
+        return _shards[(key >> 8) % NumShards];
+    }
+
+    static size_t GetEntrySize(const MinifiedSprite& sprite)
+    {
+        return sizeof(MinifiedSprite) + sprite.Data.capacity();
+    }
+
+    static bool IsCacheable(ImageIndex index, const G1Element& g1)
+    {
+        // Scrolling text and temporary images are redrawn into the same image
+        if (index == SPR_TEMP || (index >= SPR_SCROLLING_TEXT_START && index < SPR_SCROLLING_TEXT_END))
+            return false;
+        return g1.offset != nullptr && g1.width * g1.height >= MinSpriteArea;
+    }
+
+    static std::shared_ptr<MinifiedSprite> CreateMinifiedSprite(
+        const G1Element& g1, int32_t zoomShift, int32_t phaseX, int32_t phaseY)
+    {
+        const int32_t zoom = 1 << zoomShift;
+        auto sprite = std::make_shared<MinifiedSprite>();
+        sprite->Source = g1.offset;
+        sprite->Width = (g1.width - phaseX + zoom - 1) >> zoomShift;
+        sprite->Height = (g1.height - phaseY + zoom - 1) >> zoomShift;
+        if (sprite->Width <= 0 || sprite->Height <= 0)
+            return nullptr;
+
+        auto& data = sprite->Data;
+        data.resize(sprite->Height * 2);
+        for (int32_t row = 0; row < sprite->Height; row++)
+        {
+            // Line offsets are 16 bit, the minified sprite is always smaller than the original so this never happens
+            const auto lineOffset = data.size();
+            if (lineOffset > 0xFFFF)
+                return nullptr;
+            data[row * 2] = lineOffset & 0xFF;
+            data[row * 2 + 1] = (lineOffset >> 8) & 0xFF;
+
+            const int32_t y = phaseY + row * zoom;
+            const uint8_t* src0 = g1.offset;
+            const uint8_t* nextRun = src0 + (src0[y * 2] | (src0[y * 2 + 1] << 8));
+
+            size_t lastRun = data.size();
+            bool hasRun = false;
+            bool isEndOfLine = false;
+            while (!isEndOfLine)
+            {
+                const uint8_t* src = nextRun;
+                auto dataSize = *src++;
+                auto firstPixelX = *src++;
+                isEndOfLine = (dataSize & 0x80) != 0;
+                dataSize &= 0x7F;
+                nextRun = src + dataSize;
+
+                // Only keep the pixels at phaseX modulo the zoom factor. Transparent pixels are left out as well, as
+                // they are skipped when minifying but copied as they are at zoom level 0.
+                const int32_t first = firstPixelX + ((phaseX - firstPixelX) & (zoom - 1));
+                const int32_t end = firstPixelX + dataSize;
+                bool isInRun = false;
+                for (int32_t x = first; x < end; x += zoom)
+                {
+                    const auto pixel = src[x - firstPixelX];
+                    if (pixel == 0)
+                    {
+                        isInRun = false;
+                        continue;
+                    }
+                    if (!isInRun)
+                    {
+                        lastRun = data.size();
+                        hasRun = true;
+                        isInRun = true;
+                        data.push_back(0);
+                        data.push_back(static_cast<uint8_t>((x - phaseX) >> zoomShift));
+                    }
+                    data.push_back(pixel);
+                    data[lastRun]++;
+                }
+            }
+
+            if (!hasRun)
+            {
+                // Every line needs at least one run to mark its end
+                lastRun = data.size();
+                data.push_back(0);
+                data.push_back(0);
+            }
+            data[lastRun] |= 0x80;
+        }
+
+        data.shrink_to_fit();
+        return sprite;
+    }
+
+    std::shared_ptr<const MinifiedSprite> Get(
+        ImageIndex index, const G1Element& g1, int32_t zoomShift, int32_t phaseX, int32_t phaseY)
+    {
+        if (!IsCacheable(index, g1))
+            return nullptr;
+
+        const auto key = GetKey(index, zoomShift, phaseX, phaseY);
+        auto& shard = GetShard(key);
+        {
+            std::lock_guard<std::mutex> lock(shard.Mutex);
+            auto it = shard.Lookup.find(key);
+            if (it != shard.Lookup.end())
+            {
+                const auto& sprite = it->second->second;
+                if (sprite->Source == g1.offset)
+                {
+                    shard.Hits++;
+                    shard.Entries.splice(shard.Entries.begin(), shard.Entries, it->second);
+                    return sprite;
+                }
+
+                // The image was replaced without being invalidated
+                shard.Size -= GetEntrySize(*sprite);
+                shard.Entries.erase(it->second);
+                shard.Lookup.erase(it);
+            }
+            shard.Misses++;
+        }
+
+        // Create the variant without holding the lock, if another thread does the same only one of them is kept
+        auto sprite = CreateMinifiedSprite(g1, zoomShift, phaseX, phaseY);
+        if (sprite == nullptr)
+            return nullptr;
+
+        std::lock_guard<std::mutex> lock(shard.Mutex);
+        if (shard.Lookup.find(key) == shard.Lookup.end())
+        {
+            shard.Entries.emplace_front(key, sprite);
+            shard.Lookup.emplace(key, shard.Entries.begin());
+            shard.Size += GetEntrySize(*sprite);
+            while (shard.Size > Capacity / NumShards && shard.Entries.size() > 1)
+            {
+                const auto& last = shard.Entries.back();
+                shard.Size -= GetEntrySize(*last.second);
+                shard.Lookup.erase(last.first);
+                shard.Entries.pop_back();
+                shard.Evictions++;
+            }
+        }
+        return sprite;
+    }
+
+    static void Remove(Shard& shard, Key key)
+    {
+        auto it = shard.Lookup.find(key);
+        if (it != shard.Lookup.end())
+        {
+            shard.Size -= GetEntrySize(*it->second->second);
+            shard.Entries.erase(it->second);
+            shard.Lookup.erase(it);
+        }
+    }
+
+    static void Invalidate(ImageIndex index)
+    {
+        auto& shard = GetShard(GetKey(index, 0, 0, 0));
+        std::lock_guard<std::mutex> lock(shard.Mutex);
+        if (shard.Entries.empty())
+            return;
+
+        for (int32_t zoomShift = 1; zoomShift <= MaxZoomShift; zoomShift++)
+        {
+            const int32_t zoom = 1 << zoomShift;
+            for (int32_t phaseY = 0; phaseY < zoom; phaseY++)
+            {
+                for (int32_t phaseX = 0; phaseX < zoom; phaseX++)
+                {
+                    Remove(shard, GetKey(index, zoomShift, phaseX, phaseY));
+                }
+            }
+        }
+    }
+
+    void Invalidate(ImageIndex first, uint32_t count)
+    {
+        // Looking up each variant of a few images is quicker than going through every entry
+        if (count <= NumShards)
+        {
+            for (uint32_t i = 0; i < count; i++)
+            {
+                Invalidate(first + i);
+            }
+            return;
+        }
+
+        for (auto& shard : _shards)
+        {
+            std::lock_guard<std::mutex> lock(shard.Mutex);
+            for (auto it = shard.Entries.begin(); it != shard.Entries.end();)
+            {
+                const auto index = GetIndex(it->first);
+                if (index >= first && index - first < count)
+                {
+                    shard.Size -= GetEntrySize(*it->second);
+                    shard.Lookup.erase(it->first);
+                    it = shard.Entries.erase(it);
+                }
+                else
+                {
+                    it++;
+                }
+            }
+        }
+    }
+
+    void Clear()
+    {
+        for (auto& shard : _shards)
+        {
+            std::lock_guard<std::mutex> lock(shard.Mutex);
+            shard.Entries.clear();
+            shard.Lookup.clear();
+            shard.Size = 0;
+        }
+    }
+
+    Statistics GetStatistics()
+    {
+        Statistics stats;
+        stats.Capacity = Capacity;
+        for (auto& shard : _shards)
+        {
+            std::lock_guard<std::mutex> lock(shard.Mutex);
+            stats.Hits += shard.Hits;
+            stats.Misses += shard.Misses;
+            stats.Evictions += shard.Evictions;
+            stats.NumEntries += shard.Entries.size();
+            stats.Size += shard.Size;
+        }
+        return stats;
+    }
+} // namespace MinifiedSpriteCache
@@ -0,0 +1,58 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "ImageId.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+struct G1Element;
+
+/**
+ * Keeps RLE sprites drawn at zoom levels 1 to 3 with the skipped pixels already removed, so they can be drawn like a
+ * sprite at zoom level 0 instead of decoding the whole sprite again. Which pixels are skipped depends on where the
+ * sprite is drawn, so there is a variant for every position modulo the zoom factor. Variants are created the first
+ * time they are drawn and the least recently used ones are evicted once the cache is full.
+ */
+namespace MinifiedSpriteCache
+{
+    struct MinifiedSprite
+    {
+        // Line offsets and runs in the same format as RLE sprites in G1.
+        std::vector<uint8_t> Data;
+        // The pixels of the sprite this variant was created from, to detect when the image was replaced.
+        const uint8_t* Source{};
+        int16_t Width{};
+        int16_t Height{};
+    };
+
+    struct Statistics
+    {
+        uint64_t Hits{};
+        uint64_t Misses{};
+        uint64_t Evictions{};
+        size_t NumEntries{};
+        size_t Size{};
+        size_t Capacity{};
+    };
+
+    // Returns the variant of the sprite that keeps the pixels at phaseX, phaseY modulo (1 << zoomShift), creating it
+    // if needed. Returns nullptr for sprites that are not worth caching or that change while they are loaded.
+    std::shared_ptr<const MinifiedSprite> Get(
+        ImageIndex index, const G1Element& g1, int32_t zoomShift, int32_t phaseX, int32_t phaseY);
+
+    // Removes the variants of images that are freed or replaced, this is done whenever an image is set.
+    void Invalidate(ImageIndex first, uint32_t count);
+    void Clear();
+
+    Statistics GetStatistics();
+} // namespace MinifiedSpriteCache
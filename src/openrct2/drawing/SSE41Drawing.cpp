@@ -56,6 +56,68 @@ void MaskSse4_1(
     }
 }
 
+// Loads 16 pixels, taking every (1 << zoomShift)th pixel of the source for zoom levels up to 2.
+static __m128i LoadRleRunPixelsSse4_1(const uint8_t* src, int32_t zoomShift)
+{
+    const auto* src128 = reinterpret_cast<const __m128i*>(src);
+    if (zoomShift == 0)
+    {
+        return _mm_loadu_si128(src128);
+    }
+    if (zoomShift == 1)
+    {
+        // Keep the low byte of every 16 bit lane and pack them back into bytes
+        const __m128i mask = _mm_set1_epi16(0x00FF);
+        const __m128i a = _mm_and_si128(_mm_loadu_si128(src128), mask);
+        const __m128i b = _mm_and_si128(_mm_loadu_si128(src128 + 1), mask);
+        return _mm_packus_epi16(a, b);
+    }
+
+    // Keep the low byte of every 32 bit lane, _mm_packus_epi32 is SSE4.1
+    const __m128i mask = _mm_set1_epi32(0x000000FF);
+    const __m128i a = _mm_and_si128(_mm_loadu_si128(src128), mask);
+    const __m128i b = _mm_and_si128(_mm_loadu_si128(src128 + 1), mask);
+    const __m128i c = _mm_and_si128(_mm_loadu_si128(src128 + 2), mask);
+    const __m128i d = _mm_and_si128(_mm_loadu_si128(src128 + 3), mask);
+    return _mm_packus_epi16(_mm_packus_epi32(a, b), _mm_packus_epi32(c, d));
+}
+
+void BlitRleRunSse4_1(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t numPixels, int32_t zoomShift, const PaletteMap* paletteMap)
+{
+    // Runs are at most 127 pixels long, so zoom level 3 never fills a vector
+    if (zoomShift <= 2)
+    {
+        const int32_t stepPixels = 16 << zoomShift;
+        const __m128i zero = {};
+        while (numPixels >= stepPixels)
+        {
+            __m128i colour = LoadRleRunPixelsSse4_1(src, zoomShift);
+            __m128i transparent = _mm_cmpeq_epi8(colour, zero);
+            if (paletteMap != nullptr)
+            {
+                // There is no byte gather, so the remap itself stays scalar
+                alignas(16) uint8_t remapped[16];
+                _mm_store_si128(reinterpret_cast<__m128i*>(remapped), colour);
+                for (auto& pixel : remapped)
+                {
+                    pixel = (*paletteMap)[pixel];
+                }
+                colour = _mm_load_si128(reinterpret_cast<const __m128i*>(remapped));
+                transparent = _mm_or_si128(transparent, _mm_cmpeq_epi8(colour, zero));
+            }
+
+            const __m128i dest = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_blendv_epi8(colour, dest, transparent));
+
+            src += stepPixels;
+            dst += 16;
+            numPixels -= stepPixels;
+        }
+    }
+    BlitRleRunScalar(src, dst, numPixels, zoomShift, paletteMap);
+}
+
 #else
 
 #    ifdef OPENRCT2_X86
@@ -69,4 +131,10 @@ void MaskSse4_1(
     openrct2_assert(false, "SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
 }
 
+void BlitRleRunSse4_1(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t numPixels, int32_t zoomShift, const PaletteMap* paletteMap)
+{
+    openrct2_assert(false, "SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
 #endif // __SSE4_1__
@@ -364,45 +364,49 @@ void X8DrawingEngine::ConfigureDirtyGrid()
 
 void X8DrawingEngine::DrawAllDirtyBlocks()
 {
-    // TODO: For optimal performance it is currently limited to a single column.
-    // The optimal approach would be to extract all dirty regions as rectangles not including
-    // parts that are not marked dirty and have the grid more fine grained.
-    // A situation like following:
+    // Merge the dirty blocks into rectangles that never include a block that is not dirty.
+    // The grid is scanned row by row, each dirty run is extended right as far as it goes and then
+    // down while every block below it is dirty. Drawing a rectangle clears its blocks, so the
+    // rectangles never overlap. A situation like following:
     //
     //   0 1 2 3 4 5 6 7 8 9
     //   1 - - - - - - - - -
     //   2 - x x x x - - - -
     //   3 - x x - - - - - -
     //   4 - - - - - - - - -
-    //   5 - - - - - - - - -
-    //   6 - - - - - - - - -
-    //   7 - - - - - - - - -
-    //   8 - - - - - - - - -
-    //   9 - - - - - - - - -
     //
-    // Would currently redraw {2,2} to {3,5} where {3,4} and {3,5} are not dirty. Choosing to do this
-    // per column eliminates this issue but limits it to rendering just a single column at a time.
+    // is drawn as {1,2} to {4,2} followed by {1,3} to {2,3}. Wider rectangles also give the viewport
+    // renderer more columns to paint in parallel, which single block columns limited it to.
 
-    for (uint32_t x = 0; x < _dirtyGrid.BlockColumns; x++)
+    for (uint32_t y = 0; y < _dirtyGrid.BlockRows; y++)
     {
-        for (uint32_t y = 0; y < _dirtyGrid.BlockRows; y++)
+        uint32_t yOffset = y * _dirtyGrid.BlockColumns;
+        for (uint32_t x = 0; x < _dirtyGrid.BlockColumns; x++)
         {
-            uint32_t yOffset = y * _dirtyGrid.BlockColumns;
             if (_dirtyGrid.Blocks[yOffset + x] == 0)
             {
                 continue;
             }
 
-            // See comment above as to why this is 1.
-            const uint32_t columns = 1;
-
-            // Check rows
+            auto columns = GetNumDirtyColumns(x, y);
             auto rows = GetNumDirtyRows(x, y, columns);
             DrawDirtyBlocks(x, y, columns, rows);
+            x += columns - 1;
         }
     }
 }
 
+uint32_t X8DrawingEngine::GetNumDirtyColumns(const uint32_t x, const uint32_t y)
+{
+    uint32_t yOffset = y * _dirtyGrid.BlockColumns;
+    uint32_t xx = x;
+    while (xx < _dirtyGrid.BlockColumns && _dirtyGrid.Blocks[yOffset + xx] != 0)
+    {
+        xx++;
+    }
+    return xx - x;
+}
+
 uint32_t X8DrawingEngine::GetNumDirtyRows(const uint32_t x, const uint32_t y, const uint32_t columns)
 {
     uint32_t yy = y;
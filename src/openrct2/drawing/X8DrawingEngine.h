@@ -121,6 +121,7 @@ namespace OpenRCT2
         private:
             void ConfigureDirtyGrid();
             void DrawAllDirtyBlocks();
+            uint32_t GetNumDirtyColumns(const uint32_t x, const uint32_t y);
             uint32_t GetNumDirtyRows(const uint32_t x, const uint32_t y, const uint32_t columns);
             void DrawDirtyBlocks(uint32_t x, uint32_t y, uint32_t columns, uint32_t rows);
         };
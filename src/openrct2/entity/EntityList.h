@@ -21,6 +21,7 @@
 const std::list<EntityId>& GetEntityList(const EntityType id);
 
 uint16_t GetEntityListCount(EntityType list);
+const char* GetEntityTypeName(EntityType type);
 uint16_t GetMiscEntityCount();
 uint16_t GetNumFreeEntities();
 const std::vector<EntityId>& GetEntityTileList(const CoordsXY& spritePos);
@@ -98,6 +98,44 @@ uint16_t GetEntityListCount(EntityType type)
     return static_cast<uint16_t>(gEntityLists[EnumValue(type)].size());
 }
 
+const char* GetEntityTypeName(EntityType type)
+{
+    switch (type)
+    {
+        case EntityType::Null:
+            return "Null";
+        case EntityType::Guest:
+            return "Guest";
+        case EntityType::Staff:
+            return "Staff";
+        case EntityType::Vehicle:
+            return "Vehicle";
+        case EntityType::Litter:
+            return "Litter";
+        case EntityType::SteamParticle:
+            return "Misc: Steam Particle";
+        case EntityType::MoneyEffect:
+            return "Misc: Money effect";
+        case EntityType::CrashedVehicleParticle:
+            return "Misc: Crash Vehicle Particle";
+        case EntityType::ExplosionCloud:
+            return "Misc: Explosion Cloud";
+        case EntityType::CrashSplash:
+            return "Misc: Crash Splash";
+        case EntityType::ExplosionFlare:
+            return "Misc: Explosion Flare";
+        case EntityType::JumpingFountain:
+            return "Misc: Jumping fountain";
+        case EntityType::Balloon:
+            return "Misc: Balloon";
+        case EntityType::Duck:
+            return "Misc: Duck";
+        default:
+            break;
+    }
+    return "Unknown";
+}
+
 uint16_t GetNumFreeEntities()
 {
     return static_cast<uint16_t>(_freeIdList.size());
@@ -185,6 +223,7 @@ void ResetAllEntities()
     }
 
     std::fill(std::begin(_entities), std::end(_entities), Entity());
+    OpenRCT2::Profiling::SetMemoryUsage(OpenRCT2::Profiling::MemoryTag::Entities, sizeof(_entities));
     OpenRCT2::RideUse::GetHistory().Clear();
     OpenRCT2::RideUse::GetTypeHistory().Clear();
     for (int32_t i = 0; i < MAX_ENTITIES; ++i)
@@ -710,7 +710,7 @@ void PeepEntityRemove(Peep* peep)
     }
     EntityRemove(peep);
 
-    auto intent = Intent(wasGuest ? INTENT_ACTION_REFRESH_GUEST_LIST : INTENT_ACTION_REFRESH_STAFF_LIST);
+    auto intent = Intent(wasGuest ? INTENT_ACTION_UPDATE_GUEST_LIST : INTENT_ACTION_REFRESH_STAFF_LIST);
     ContextBroadcastIntent(&intent);
 }
 
@@ -0,0 +1,289 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CaptureQueue.h"
+
+#include "../Diagnostic.h"
+#include "../core/FileStream.h"
+#include "../core/Imaging.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+using namespace OpenRCT2;
+
+namespace CaptureQueue
+{
+    constexpr uint32_t RawMagic = 0x46435254; // TRCF
+    constexpr uint32_t RawVersion = 1;
+
+    // Raw frames start with the magic, version, width and height as little endian 32 bit integers, then the palette as
+    // PALETTE_SIZE BGRA entries and then Width * Height palette indices.
+    constexpr size_t RawHeaderSize = 4 * sizeof(uint32_t);
+
+    static void WriteLittleEndian(uint8_t* dst, uint32_t value)
+    {
+        dst[0] = value & 0xFF;
+        dst[1] = (value >> 8) & 0xFF;
+        dst[2] = (value >> 16) & 0xFF;
+        dst[3] = (value >> 24) & 0xFF;
+    }
+
+    class FrameWriter
+    {
+    private:
+        std::mutex _mutex;
+        std::condition_variable _pendingChanged;
+        std::deque<CaptureFramePtr> _pending;
+        std::vector<std::unique_ptr<CaptureFrame>> _unused;
+        size_t _numFrameBuffers{};
+        bool _isWriting{};
+        bool _stop{};
+        std::thread _thread;
+
+        CaptureStatistics _stats;
+        double _totalRenderMs{};
+        double _totalEncodeMs{};
+
+    public:
+        ~FrameWriter()
+        {
+            Shutdown();
+        }
+
+        CaptureFramePtr AcquireFrame()
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_unused.empty())
+            {
+                auto frame = std::move(_unused.back());
+                _unused.pop_back();
+                return CaptureFramePtr(frame.release());
+            }
+            if (_numFrameBuffers < NumFrameBuffers)
+            {
+                _numFrameBuffers++;
+                return CaptureFramePtr(new CaptureFrame());
+            }
+
+            _stats.NumDropped++;
+            LOG_VERBOSE("Dropped capture frame, %zu frames are still waiting to be written", _pending.size());
+            return nullptr;
+        }
+
+        void Submit(CaptureFramePtr frame, double renderMs)
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _pending.push_back(std::move(frame));
+                _stats.NumCaptured++;
+                _totalRenderMs += renderMs;
+                if (!_thread.joinable())
+                {
+                    _stop = false;
+                    _thread = std::thread([this]() { Run(); });
+                }
+            }
+            _pendingChanged.notify_all();
+        }
+
+        void Release(CaptureFrame* frame)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _unused.emplace_back(frame);
+        }
+
+        void Shutdown()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stop = true;
+            }
+            _pendingChanged.notify_all();
+            if (_thread.joinable())
+            {
+                _thread.join();
+            }
+        }
+
+        void Flush()
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _pendingChanged.wait(lock, [this]() { return _pending.empty() && !_isWriting; });
+        }
+
+        CaptureStatistics GetStatistics()
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto stats = _stats;
+            stats.NumQueued = static_cast<uint32_t>(_pending.size() + (_isWriting ? 1 : 0));
+            if (stats.NumCaptured != 0)
+            {
+                stats.AverageRenderMs = _totalRenderMs / stats.NumCaptured;
+            }
+            const auto numEncoded = stats.NumWritten + stats.NumFailed;
+            if (numEncoded != 0)
+            {
+                stats.AverageEncodeMs = _totalEncodeMs / numEncoded;
+            }
+            if (_totalEncodeMs > 0)
+            {
+                stats.EncodeFramesPerSecond = stats.NumWritten / (_totalEncodeMs / 1000.0);
+            }
+            return stats;
+        }
+
+        void ResetStatistics()
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stats = {};
+            _totalRenderMs = 0;
+            _totalEncodeMs = 0;
+        }
+
+    private:
+        void Run()
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            while (true)
+            {
+                // Frames that are still queued when the game exits are written before stopping
+                _pendingChanged.wait(lock, [this]() { return _stop || !_pending.empty(); });
+                if (_pending.empty())
+                    break;
+
+                auto frame = std::move(_pending.front());
+                _pending.pop_front();
+                _isWriting = true;
+                lock.unlock();
+
+                const auto startTime = std::chrono::high_resolution_clock::now();
+                const auto bytesWritten = Write(*frame);
+                const auto encodeMs = std::chrono::duration<double, std::milli>(
+                                          std::chrono::high_resolution_clock::now() - startTime)
+                                          .count();
+
+                lock.lock();
+                _isWriting = false;
+                _totalEncodeMs += encodeMs;
+                if (bytesWritten != 0)
+                {
+                    _stats.NumWritten++;
+                    _stats.BytesWritten += bytesWritten;
+                }
+                else
+                {
+                    _stats.NumFailed++;
+                }
+                // Not released through the frame as the lock is held
+                _unused.emplace_back(frame.release());
+                _pendingChanged.notify_all();
+            }
+        }
+
+    public:
+        // Returns the size of the written file, or 0 if it could not be written.
+        static uint64_t Write(CaptureFrame& frame)
+        {
+            try
+            {
+                if (frame.Format == CaptureFormat::Raw)
+                {
+                    uint8_t header[RawHeaderSize];
+                    WriteLittleEndian(header, RawMagic);
+                    WriteLittleEndian(header + 4, RawVersion);
+                    WriteLittleEndian(header + 8, static_cast<uint32_t>(frame.Width));
+                    WriteLittleEndian(header + 12, static_cast<uint32_t>(frame.Height));
+                    FileStream fs(frame.Path, FILE_MODE_WRITE);
+                    fs.Write(header, sizeof(header));
+                    fs.Write(frame.Palette.Colour, sizeof(frame.Palette.Colour));
+                    fs.Write(frame.Pixels.data(), frame.Pixels.size());
+                    return fs.GetLength();
+                }
+
+                // The pixels are moved into the image and back so the frame buffer can be reused
+                Image image;
+                image.Width = frame.Width;
+                image.Height = frame.Height;
+                image.Depth = 8;
+                image.Stride = frame.Width;
+                image.Palette = std::make_unique<GamePalette>(frame.Palette);
+                image.Pixels = std::move(frame.Pixels);
+                try
+                {
+                    Imaging::WriteToFile(frame.Path, image, IMAGE_FORMAT::PNG);
+                }
+                catch (const std::exception&)
+                {
+                    frame.Pixels = std::move(image.Pixels);
+                    throw;
+                }
+                frame.Pixels = std::move(image.Pixels);
+
+                FileStream fs(frame.Path, FILE_MODE_OPEN);
+                return fs.GetLength();
+            }
+            catch (const std::exception& e)
+            {
+                LOG_ERROR("Unable to write capture %s: %s", frame.Path.c_str(), e.what());
+                return 0;
+            }
+        }
+    };
+
+    static FrameWriter& GetFrameWriter()
+    {
+        static FrameWriter writer;
+        return writer;
+    }
+
+    CaptureFramePtr AcquireFrame()
+    {
+        return GetFrameWriter().AcquireFrame();
+    }
+
+    void Submit(CaptureFramePtr frame, double renderMs)
+    {
+        GetFrameWriter().Submit(std::move(frame), renderMs);
+    }
+
+    void Flush()
+    {
+        GetFrameWriter().Flush();
+    }
+
+    void Shutdown()
+    {
+        GetFrameWriter().Shutdown();
+    }
+
+    bool WriteFrame(CaptureFrame& frame)
+    {
+        return FrameWriter::Write(frame) != 0;
+    }
+
+    CaptureStatistics GetStatistics()
+    {
+        return GetFrameWriter().GetStatistics();
+    }
+
+    void ResetStatistics()
+    {
+        GetFrameWriter().ResetStatistics();
+    }
+} // namespace CaptureQueue
+
+void CaptureFrameReleaser::operator()(CaptureFrame* frame) const
+{
+    CaptureQueue::GetFrameWriter().Release(frame);
+}
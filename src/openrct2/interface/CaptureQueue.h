@@ -0,0 +1,85 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../drawing/Drawing.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+enum class CaptureFormat : uint8_t
+{
+    Png,
+    // The size, the palette and one palette index per pixel, see CaptureQueue.cpp.
+    Raw,
+};
+
+struct CaptureFrame
+{
+    std::string Path;
+    CaptureFormat Format{};
+    int32_t Width{};
+    int32_t Height{};
+    GamePalette Palette;
+    std::vector<uint8_t> Pixels;
+};
+
+// Returns the frame to the pool of frame buffers instead of freeing it.
+struct CaptureFrameReleaser
+{
+    void operator()(CaptureFrame* frame) const;
+};
+
+using CaptureFramePtr = std::unique_ptr<CaptureFrame, CaptureFrameReleaser>;
+
+struct CaptureStatistics
+{
+    uint32_t NumQueued{};
+    uint64_t NumCaptured{};
+    uint64_t NumWritten{};
+    uint64_t NumDropped{};
+    uint64_t NumFailed{};
+    uint64_t BytesWritten{};
+    double AverageRenderMs{};
+    double AverageEncodeMs{};
+    // Frames written per second of encoding time.
+    double EncodeFramesPerSecond{};
+};
+
+/**
+ * Writes captured frames on a background thread so that capturing does not hold up the game while the frame is
+ * encoded. Frames are rendered into a small pool of buffers, when every buffer is still waiting to be written the
+ * frame is dropped rather than queueing without bound.
+ */
+namespace CaptureQueue
+{
+    constexpr size_t NumFrameBuffers = 4;
+
+    // Returns an unused frame buffer, or nullptr if the frame has to be dropped. The buffer goes back to the pool when
+    // it is released without being submitted.
+    CaptureFramePtr AcquireFrame();
+
+    // Queues the rendered frame to be written, renderMs is how long rendering it took.
+    void Submit(CaptureFramePtr frame, double renderMs);
+
+    // Waits for every queued frame to be written.
+    void Flush();
+
+    // Writes the queued frames and stops the writer thread, it is started again by the next frame.
+    void Shutdown();
+
+    // Writes the frame straight away on the calling thread, returns false if it could not be written.
+    bool WriteFrame(CaptureFrame& frame);
+
+    CaptureStatistics GetStatistics();
+    void ResetStatistics();
+} // namespace CaptureQueue
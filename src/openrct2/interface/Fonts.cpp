@@ -9,6 +9,7 @@
 
 #include "Fonts.h"
 
+#include "../OpenRCT2.h"
 #include "../config/Config.h"
 #include "../core/String.hpp"
 #include "../drawing/TTF.h"
@@ -148,6 +149,13 @@ static bool LoadCustomConfigFont(LocalisationService& localisationService)
 void TryLoadFonts(LocalisationService& localisationService)
 {
 #ifndef NO_TTF
+    // Instances without graphics never draw text, so there is no need to load any TrueType fonts
+    if (gOpenRCT2NoGraphics)
+    {
+        LoadSpriteFont(localisationService);
+        return;
+    }
+
     auto currentLanguage = localisationService.GetCurrentLanguage();
     TTFontFamily const* fontFamily = LanguagesDescriptors[currentLanguage].font_family;
 
@@ -16,6 +16,7 @@
 #include "../OpenRCT2.h"
 #include "../PlatformEnvironment.h"
 #include "../ReplayManager.h"
+#include "../TickWatchdog.h"
 #include "../Version.h"
 #include "../actions/CheatSetAction.h"
 #include "../actions/ClimateSetAction.h"
@@ -64,6 +65,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cinttypes>
 #include <cmath>
 #include <cstdarg>
 #include <cstdlib>
@@ -76,6 +78,9 @@
 #ifndef NO_TTF
 #    include "../drawing/TTF.h"
 #endif
+#ifdef ENABLE_SCRIPTING
+#    include "../scripting/ScriptEngine.h"
+#endif
 
 using arguments_t = std::vector<std::string>;
 using OpenRCT2::Date;
@@ -1413,6 +1418,17 @@ static int32_t ConsoleCommandRemoveParkFences(InteractiveConsole& console, [[may
     return 0;
 }
 
+static int32_t ConsoleCommandTickStats(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    const auto stats = OpenRCT2::GetContext()->GetGameState()->GetTickWatchdog().GetStatistics();
+    console.WriteFormatLine("Ticks sampled: %u", stats.NumTicks);
+    console.WriteFormatLine("p50: %.2f ms", stats.P50Ms);
+    console.WriteFormatLine("p99: %.2f ms", stats.P99Ms);
+    console.WriteFormatLine("max: %.2f ms", stats.MaxMs);
+    console.WriteFormatLine("Ticks over budget: %u", stats.NumHitches);
+    return 0;
+}
+
 static int32_t ConsoleCommandShowLimits(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
 {
     const auto& tileElements = GetTileElements();
@@ -1908,6 +1924,118 @@ static int32_t ConsoleCommandProfilerExportCSV(
     return 0;
 }
 
+static int32_t ConsoleCommandProfilerTrace(InteractiveConsole& console, const arguments_t& argv)
+{
+    if (argv.size() < 1)
+    {
+        console.WriteLineError("Missing argument: <output file> or stop");
+        return 1;
+    }
+
+    if (argv[0] == "stop")
+    {
+        if (!OpenRCT2::Profiling::IsTracing())
+        {
+            console.WriteLineError("No trace is being recorded");
+            return 1;
+        }
+        OpenRCT2::Profiling::StopTrace();
+        console.WriteLine("Stopped trace");
+        return 0;
+    }
+
+    uint32_t numTicks = 0;
+    if (argv.size() >= 2)
+    {
+        bool valid;
+        auto value = ConsoleParseInt(argv[1], &valid);
+        if (!valid || value < 0)
+        {
+            console.WriteLineError("Invalid argument: <ticks>");
+            return 1;
+        }
+        numTicks = static_cast<uint32_t>(value);
+    }
+    OpenRCT2::Profiling::StartTrace(numTicks, argv[0]);
+    if (numTicks == 0)
+        console.WriteFormatLine("Started trace, use profiler_trace stop to write it to %s", argv[0].c_str());
+    else
+        console.WriteFormatLine("Started trace, it will be written to %s after %u ticks", argv[0].c_str(), numTicks);
+    return 0;
+}
+
+static int32_t ConsoleCommandProfilerMemory(InteractiveConsole& console, const arguments_t& argv)
+{
+    if (argv.size() >= 1)
+    {
+        if (argv[0] == "start")
+        {
+            if (!OpenRCT2::Profiling::IsMemoryTrackingEnabled())
+                console.WriteLine("Started memory tracking");
+            OpenRCT2::Profiling::EnableMemoryTracking();
+        }
+        else if (argv[0] == "stop")
+        {
+            if (OpenRCT2::Profiling::IsMemoryTrackingEnabled())
+                console.WriteLine("Stopped memory tracking");
+            OpenRCT2::Profiling::DisableMemoryTracking();
+        }
+        else
+        {
+            console.WriteLineError("Invalid argument, expected start or stop");
+            return 1;
+        }
+        return 0;
+    }
+
+    if (!OpenRCT2::Profiling::IsMemoryTrackingEnabled())
+    {
+        console.WriteLine("Memory tracking is disabled, only buffer sizes are reported");
+    }
+
+    console.WriteFormatLine(
+        "%-16s %12s %12s %12s %12s %12s", "subsystem", "current KiB", "peak KiB", "allocations", "allocs/tick",
+        "KiB/tick");
+    for (const auto& data : OpenRCT2::Profiling::GetMemoryData())
+    {
+        console.WriteFormatLine(
+            "%-16s %12.1f %12.1f %12" PRIu64 " %12" PRIu64 " %12.1f", data.Name, data.CurrentBytes / 1024.0,
+            data.PeakBytes / 1024.0, data.AllocationCount, data.TickAllocationCount, data.TickAllocatedBytes / 1024.0);
+    }
+    return 0;
+}
+
+#ifdef ENABLE_SCRIPTING
+static int32_t ConsoleCommandProfilerPlugins(InteractiveConsole& console, const arguments_t& argv)
+{
+    auto& scriptEngine = OpenRCT2::GetContext()->GetScriptEngine();
+    if (argv.size() >= 1)
+    {
+        if (argv[0] != "reset")
+        {
+            console.WriteLineError("Invalid argument, expected reset");
+            return 1;
+        }
+        scriptEngine.ResetPluginCallTimings();
+        return 0;
+    }
+
+    console.WriteFormatLine(
+        "%-24s %-24s %10s %12s %12s %12s", "plugin", "call", "calls", "total ms", "average ms", "max ms");
+    for (const auto& plugin : scriptEngine.GetPlugins())
+    {
+        for (const auto& timings : plugin->GetCallTimings())
+        {
+            console.WriteFormatLine(
+                "%-24s %-24s %10u %12.2f %12.4f %12.2f", plugin->GetMetadata().Name.c_str(),
+                std::string(timings.Name).c_str(), timings.CallCount, timings.TotalMs,
+                timings.TotalMs / std::max<uint32_t>(timings.CallCount, 1), timings.MaxMs);
+        }
+    }
+    return 0;
+}
+#endif
+
 static int32_t ConsoleCommandProfilerStop(
     [[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
 {
@@ -2018,6 +2146,7 @@ static constexpr ConsoleCommand console_command_table[] = {
     { "show_limits", ConsoleCommandShowLimits, "Shows the map data counts and limits.", "show_limits" },
     { "staff", ConsoleCommandStaff, "Staff management.", "staff <subcommand>" },
     { "terminate", ConsoleCommandTerminate, "Calls std::terminate(), for testing purposes only.", "terminate" },
+    { "tick_stats", ConsoleCommandTickStats, "Shows the tick times of the last minute.", "tick_stats" },
     { "variables", ConsoleCommandVariables, "Lists all the variables that can be used with get and sometimes set.",
       "variables" },
     { "windows", ConsoleCommandWindows, "Lists all the windows that can be opened.", "windows" },
@@ -2035,6 +2164,14 @@ static constexpr ConsoleCommand console_command_table[] = {
     { "profiler_stop", ConsoleCommandProfilerStop, "Stops the profiler.", "profiler_stop [<output file>]" },
     { "profiler_exportcsv", ConsoleCommandProfilerExportCSV, "Exports the current profiler data.",
       "profiler_exportcsv <output file>" },
+    { "profiler_trace", ConsoleCommandProfilerTrace, "Records a timeline of profiled functions for a number of ticks, 0 until stopped.",
+      "profiler_trace <output file>|stop [<ticks>]" },
+    { "profiler_memory", ConsoleCommandProfilerMemory,
+      "Shows the memory used by each subsystem, or starts and stops tracking allocations.", "profiler_memory [start|stop]" },
+#ifdef ENABLE_SCRIPTING
+    { "profiler_plugins", ConsoleCommandProfilerPlugins,
+      "Shows the time each plug-in has spent in its hooks, intervals and custom actions.", "profiler_plugins [reset]" },
+#endif
 };
 
 static int32_t ConsoleCommandWindows(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
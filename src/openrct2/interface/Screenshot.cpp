@@ -22,7 +22,10 @@
 #include "../core/Imaging.h"
 #include "../core/Path.hpp"
 #include "../drawing/Drawing.h"
+#include "../drawing/MinifiedSpriteCache.h"
 #include "../drawing/X8DrawingEngine.h"
+#include "../entity/EntityList.h"
+#include "../entity/EntityRegistry.h"
 #include "../localisation/Formatter.h"
 #include "../localisation/Localisation.h"
 #include "../platform/Platform.h"
@@ -31,6 +34,7 @@
 #include "../world/Map.h"
 #include "../world/Park.h"
 #include "../world/Surface.h"
+#include "CaptureQueue.h"
 #include "Viewport.h"
 
 #include <algorithm>
@@ -39,6 +43,7 @@
 #include <cstdlib>
 #include <memory>
 #include <optional>
+#include <random>
 #include <string>
 
 using namespace std::literals::string_literals;
@@ -131,7 +136,7 @@ static std::string ScreenshotGetFormattedDateTime()
     return formatted;
 }
 
-static std::optional<std::string> ScreenshotGetNextPath()
+static std::optional<std::string> ScreenshotGetNextPath(std::string_view extension = ".png")
 {
     auto screenshotDirectory = ScreenshotGetDirectory();
     if (!Path::CreateDirectory(screenshotDirectory))
@@ -145,9 +150,9 @@ static std::optional<std::string> ScreenshotGetNextPath()
     auto name = parkName + " " + dateTime;
 
     // Generate a path with a `tries` number
-    auto pathComposer = [&screenshotDirectory, &name](int tries) {
+    auto pathComposer = [&screenshotDirectory, &name, extension](int tries) {
         auto composedFilename = Platform::SanitiseFilename(
-            name + ((tries > 0) ? " ("s + std::to_string(tries) + ")" : ""s) + ".png");
+            name + ((tries > 0) ? " ("s + std::to_string(tries) + ")" : ""s) + std::string(extension));
         return screenshotDirectory + PATH_SEPARATOR + composedFilename;
     };
 
@@ -399,6 +404,17 @@ template<typename FN> static inline double MeasureFunctionTime(const FN& fn)
     return std::chrono::duration<double>(endTime - startTime).count();
 }
 
+static void BenchgfxPrintSpriteCacheStatistics()
+{
+    const auto stats = MinifiedSpriteCache::GetStatistics();
+    const auto lookups = stats.Hits + stats.Misses;
+    std::printf(
+        "Minified sprite cache: %.1f%% hits, %llu misses, %llu evictions, %zu entries, %.1f / %.1f MiB\n",
+        lookups == 0 ? 0.0 : 100.0 * stats.Hits / lookups, static_cast<unsigned long long>(stats.Misses),
+        static_cast<unsigned long long>(stats.Evictions), stats.NumEntries, stats.Size / (1024.0 * 1024.0),
+        stats.Capacity / (1024.0 * 1024.0));
+}
+
 static void BenchgfxRenderScreenshots(const char* inputPath, std::unique_ptr<IContext>& context, uint32_t iterationCount)
 {
     if (!context->LoadParkFromFile(inputPath))
@@ -472,6 +488,7 @@ static void BenchgfxRenderScreenshots(const char* inputPath, std::unique_ptr<ICo
         }
         std::printf("Total average: %.06fs, %.f FPS\n", average, 1.0 / average);
         std::printf("Time: %.05fs\n", totalTime);
+        BenchgfxPrintSpriteCacheStatistics();
     }
     catch (const std::exception& e)
     {
@@ -513,6 +530,187 @@ int32_t CommandLineForGfxbench(const char** argv, int32_t argc)
     return 1;
 }
 
+/**
+ * Drawing engine for the dirty region benchmark. There are no windows when headless, so each dirty rectangle
+ * draws a viewport that covers the whole screen, as the main window would.
+ */
+class BenchgfxDrawingEngine final : public X8DrawingEngine
+{
+public:
+    Viewport View{};
+    uint32_t NumRects{};
+    uint64_t NumPixels{};
+
+    using X8DrawingEngine::X8DrawingEngine;
+
+protected:
+    void OnDrawDirtyBlock(uint32_t x, uint32_t y, uint32_t columns, uint32_t rows) override
+    {
+        const int32_t left = x * _dirtyGrid.BlockWidth;
+        const int32_t top = y * _dirtyGrid.BlockHeight;
+        const int32_t right = std::min<int32_t>(_width, left + columns * _dirtyGrid.BlockWidth);
+        const int32_t bottom = std::min<int32_t>(_height, top + rows * _dirtyGrid.BlockHeight);
+
+        NumRects++;
+        NumPixels += static_cast<uint64_t>(right - left) * (bottom - top);
+        ViewportRender(_bitsDPI, &View, { { left, top }, { right, bottom } });
+    }
+};
+
+enum class BenchgfxInvalidation
+{
+    // Every entity on screen moves each frame, like guests and vehicles in a busy park.
+    Entities,
+    // Small areas spread over the screen, like animated scenery and ride parts.
+    Scattered,
+    // The whole screen, like scrolling the view.
+    Full,
+};
+
+static constexpr const char* BenchgfxInvalidationNames[] = {
+    "entities",
+    "scattered",
+    "full",
+};
+
+static void BenchgfxInvalidate(BenchgfxDrawingEngine& engine, BenchgfxInvalidation pattern, std::minstd_rand& random)
+{
+    const auto& viewport = engine.View;
+    switch (pattern)
+    {
+        case BenchgfxInvalidation::Entities:
+            for (int32_t type = 0; type < EnumValue(EntityType::Count); type++)
+            {
+                for (auto id : GetEntityList(static_cast<EntityType>(type)))
+                {
+                    const auto* entity = GetEntity(id);
+                    if (entity == nullptr || entity->x == LOCATION_NULL)
+                        continue;
+
+                    const auto& rect = entity->SpriteData.SpriteRect;
+                    engine.Invalidate(
+                        viewport.zoom.ApplyInversedTo(rect.GetLeft() - viewport.viewPos.x),
+                        viewport.zoom.ApplyInversedTo(rect.GetTop() - viewport.viewPos.y),
+                        viewport.zoom.ApplyInversedTo(rect.GetRight() - viewport.viewPos.x) + 1,
+                        viewport.zoom.ApplyInversedTo(rect.GetBottom() - viewport.viewPos.y) + 1);
+                }
+            }
+            break;
+        case BenchgfxInvalidation::Scattered:
+            for (int32_t i = 0; i < 64; i++)
+            {
+                const auto left = static_cast<int32_t>(random() % viewport.width);
+                const auto top = static_cast<int32_t>(random() % viewport.height);
+                engine.Invalidate(left, top, left + 24, top + 24);
+            }
+            break;
+        case BenchgfxInvalidation::Full:
+            engine.Invalidate(0, 0, viewport.width, viewport.height);
+            break;
+    }
+}
+
+static void BenchgfxRenderDirtyFrames(const char* inputPath, std::unique_ptr<IContext>& context, uint32_t frameCount)
+{
+    if (!context->LoadParkFromFile(inputPath))
+    {
+        return;
+    }
+
+    gIntroState = IntroState::None;
+    gScreenFlags = SCREEN_FLAGS_PLAYING;
+
+    constexpr int32_t ScreenWidth = 1920;
+    constexpr int32_t ScreenHeight = 1080;
+
+    // Entity screen positions are only kept for the current rotation
+    const auto rotation = GetCurrentRotation();
+    const auto centre = Translate3DTo2DWithZ(rotation, { CoordsXY{ gMapSize.x * 16, gMapSize.y * 16 }, 0 });
+
+    BenchgfxDrawingEngine engine(context->GetUiContext());
+    engine.Resize(ScreenWidth, ScreenHeight);
+
+    std::printf("Engine: dirty rectangles, %dx%d, %u frames\n", ScreenWidth, ScreenHeight, frameCount);
+    for (size_t i = 0; i < std::size(BenchgfxInvalidationNames); i++)
+    {
+        const auto pattern = static_cast<BenchgfxInvalidation>(i);
+        for (ZoomLevel zoom{ 0 }; zoom < ZoomLevel::max(); zoom++)
+        {
+            auto& viewport = engine.View;
+            viewport.width = ScreenWidth;
+            viewport.height = ScreenHeight;
+            viewport.view_width = zoom.ApplyTo(ScreenWidth);
+            viewport.view_height = zoom.ApplyTo(ScreenHeight);
+            viewport.viewPos = { centre.x - viewport.view_width / 2, centre.y - viewport.view_height / 2 };
+            viewport.zoom = zoom;
+
+            // Start from a complete frame, as the game would after the view was opened
+            engine.Invalidate(0, 0, ScreenWidth, ScreenHeight);
+            engine.PaintWindows();
+
+            std::minstd_rand random(1);
+            double totalTime = 0.0;
+            engine.NumRects = 0;
+            engine.NumPixels = 0;
+            for (uint32_t frame = 0; frame < frameCount; frame++)
+            {
+                if (pattern == BenchgfxInvalidation::Entities)
+                {
+                    context->GetGameState()->UpdateLogic();
+                }
+                BenchgfxInvalidate(engine, pattern, random);
+                totalTime += MeasureFunctionTime([&engine]() { engine.PaintWindows(); });
+            }
+
+            const auto average = totalTime / frameCount;
+            const auto coverage = static_cast<double>(engine.NumPixels) / frameCount / (ScreenWidth * ScreenHeight);
+            std::printf(
+                "%-9s zoom[%d] average: %.06fs, %.f FPS, %.1f rects, %.1f%% of the screen per frame\n",
+                BenchgfxInvalidationNames[i], static_cast<int8_t>(zoom), average, 1.0 / average,
+                static_cast<double>(engine.NumRects) / frameCount, coverage * 100.0);
+        }
+    }
+    BenchgfxPrintSpriteCacheStatistics();
+}
+
+int32_t CommandLineForGfxbenchDirty(const char** argv, int32_t argc)
+{
+    if (argc != 1 && argc != 2)
+    {
+        printf("Usage: openrct2 benchgfx dirty <file> [<frame_count>]\n");
+        return -1;
+    }
+
+    int32_t frameCount = 100;
+    if (argc == 2)
+    {
+        frameCount = std::max(1, atoi(argv[1]));
+    }
+
+    const char* inputPath = argv[0];
+
+    gOpenRCT2Headless = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (context->Initialise())
+    {
+        DrawingEngineInit();
+
+        try
+        {
+            BenchgfxRenderDirtyFrames(inputPath, context, frameCount);
+        }
+        catch (const std::exception& e)
+        {
+            Console::Error::WriteLine("%s", e.what());
+        }
+
+        DrawingEngineDispose();
+    }
+
+    return 1;
+}
+
 static void ApplyOptions(const ScreenshotOptions* options, Viewport& viewport)
 {
     if (options->weather != WeatherType::Sunny && options->weather != WeatherType::Count)
@@ -717,12 +915,21 @@ static bool IsPathChildOf(fs::path x, const fs::path& parent)
     return false;
 }
 
-static std::string ResolveFilenameForCapture(const fs::path& filename)
+static std::string ResolveFilenameForCapture(const fs::path& filename, const CaptureOptions& options)
 {
     if (filename.empty())
     {
-        // Automatic filename
-        auto path = ScreenshotGetNextPath();
+        // Automatic filename. Queued frames are not written yet, so number them to keep their names apart.
+        static uint32_t frameNumber = 0;
+        std::string extension = options.Format == CaptureFormat::Raw ? ".raw" : ".png";
+        if (options.Async)
+        {
+            char suffix[16];
+            snprintf(suffix, sizeof(suffix), " %06u", frameNumber++);
+            extension = suffix + extension;
+        }
+
+        auto path = ScreenshotGetNextPath(extension);
         if (!path)
         {
             throw std::runtime_error("Unable to generate a filename for capture.");
@@ -751,7 +958,7 @@ static std::string ResolveFilenameForCapture(const fs::path& filename)
     return screenshotPath.u8string();
 }
 
-void CaptureImage(const CaptureOptions& options)
+bool CaptureImage(const CaptureOptions& options)
 {
     Viewport viewport{};
     if (options.View.has_value())
@@ -781,11 +988,56 @@ void CaptureImage(const CaptureOptions& options)
         viewport.flags |= VIEWPORT_FLAG_TRANSPARENT_BACKGROUND;
     }
 
-    auto outputPath = ResolveFilenameForCapture(options.Filename);
+    if (options.Async)
+    {
+        // The frame goes back to the pool if rendering fails before it is submitted
+        auto frame = CaptureQueue::AcquireFrame();
+        if (frame == nullptr)
+        {
+            gCurrentRotation = backupRotation;
+            return false;
+        }
+
+        // Render into the pooled frame buffer, the frame is written on a background thread
+        frame->Path = ResolveFilenameForCapture(options.Filename, options);
+        frame->Format = options.Format;
+        frame->Width = viewport.width;
+        frame->Height = viewport.height;
+        frame->Palette = gPalette;
+        frame->Pixels.assign(static_cast<size_t>(viewport.width) * viewport.height, PALETTE_INDEX_0);
+
+        DrawPixelInfo dpi;
+        dpi.bits = frame->Pixels.data();
+        dpi.width = viewport.width;
+        dpi.height = viewport.height;
+        const double renderTime = MeasureFunctionTime([&viewport, &dpi]() { RenderViewport(nullptr, viewport, dpi); });
+        CaptureQueue::Submit(std::move(frame), renderTime * 1000.0);
+
+        gCurrentRotation = backupRotation;
+        return true;
+    }
+
+    auto outputPath = ResolveFilenameForCapture(options.Filename, options);
     auto dpi = CreateDPI(viewport);
     RenderViewport(nullptr, viewport, dpi);
-    WriteDpiToFile(outputPath, dpi, gPalette);
+    bool written;
+    if (options.Format == CaptureFormat::Raw)
+    {
+        CaptureFrame frame;
+        frame.Path = outputPath;
+        frame.Format = options.Format;
+        frame.Width = dpi.width;
+        frame.Height = dpi.height;
+        frame.Palette = gPalette;
+        frame.Pixels.assign(dpi.bits, dpi.bits + static_cast<size_t>(dpi.width) * dpi.height);
+        written = CaptureQueue::WriteFrame(frame);
+    }
+    else
+    {
+        written = WriteDpiToFile(outputPath, dpi, gPalette);
+    }
     ReleaseDPI(dpi);
 
     gCurrentRotation = backupRotation;
+    return written;
 }
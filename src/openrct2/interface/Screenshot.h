@@ -19,6 +19,7 @@
 #include <string>
 
 struct DrawPixelInfo;
+enum class CaptureFormat : uint8_t;
 
 extern uint8_t gScreenshotCountdown;
 
@@ -50,6 +51,10 @@ struct CaptureOptions
     ZoomLevel Zoom;
     uint8_t Rotation{};
     bool Transparent{};
+    // Render into a pooled frame buffer and write it on a background thread, the frame is dropped if too many
+    // frames are still waiting to be written.
+    bool Async{};
+    CaptureFormat Format{};
 };
 
 void ScreenshotCheck();
@@ -60,5 +65,7 @@ std::string ScreenshotDumpPNG32bpp(int32_t width, int32_t height, const void* pi
 void ScreenshotGiant();
 int32_t CommandLineForScreenshot(const char** argv, int32_t argc, ScreenshotOptions* options);
 int32_t CommandLineForGfxbench(const char** argv, int32_t argc);
+int32_t CommandLineForGfxbenchDirty(const char** argv, int32_t argc);
 
-void CaptureImage(const CaptureOptions& options);
+// Returns false if the frame was dropped, or if it was written synchronously and writing failed.
+bool CaptureImage(const CaptureOptions& options);
@@ -43,7 +43,7 @@
 // It is used for making sure only compatible builds get connected, even within
 // single OpenRCT2 version.
 
-#define NETWORK_STREAM_VERSION "10"
+#define NETWORK_STREAM_VERSION "11"
 
 #define NETWORK_STREAM_ID OPENRCT2_VERSION "-" NETWORK_STREAM_VERSION
 
@@ -269,6 +269,7 @@ bool NetworkBase::BeginClient(const std::string& host, uint16_t port)
     _serverConnection->Socket = CreateTcpSocket();
     _serverConnection->Socket->ConnectAsync(host, port);
     _serverState.gamestateSnapshotsEnabled = false;
+    _serverState.parallelRideRatings = false;
 
     status = NETWORK_STATUS_CONNECTING;
     _lastConnectStatus = SocketStatus::Closed;
@@ -409,6 +410,8 @@ bool NetworkBase::BeginServer(uint16_t port, const std::string& address)
     status = NETWORK_STATUS_CONNECTED;
     listening_port = port;
     _serverState.gamestateSnapshotsEnabled = gConfigNetwork.DesyncDebugging;
+    // Clients use the same setting as the server, as it changes the ticks on which the ratings are updated
+    _serverState.parallelRideRatings = gConfigGeneral.ParallelRideRatings;
     _advertiser = CreateServerAdvertiser(listening_port);
 
     GameLoadScripts();
@@ -1630,6 +1633,7 @@ void NetworkBase::ServerSendGameInfo(NetworkConnection& connection)
 
     packet.WriteString(jsonObj.dump());
     packet << _serverState.gamestateSnapshotsEnabled;
+    packet << _serverState.parallelRideRatings;
     packet << IsServerPlayerInvisible;
 
 #    endif
@@ -3178,6 +3182,7 @@ void NetworkBase::Client_Handle_GAMEINFO([[maybe_unused]] NetworkConnection& con
 {
     auto jsonString = packet.ReadString();
     packet >> _serverState.gamestateSnapshotsEnabled;
+    packet >> _serverState.parallelRideRatings;
     packet >> IsServerPlayerInvisible;
 
     json_t jsonData = Json::FromString(jsonString);
@@ -3994,6 +3999,11 @@ bool NetworkGamestateSnapshotsEnabled()
     return NetworkGetServerState().gamestateSnapshotsEnabled;
 }
 
+bool NetworkParallelRideRatingsEnabled()
+{
+    return NetworkGetServerState().parallelRideRatings;
+}
+
 json_t NetworkGetServerInfoAsJson()
 {
     auto& network = OpenRCT2::GetContext()->GetNetwork();
@@ -4030,6 +4040,10 @@ bool NetworkGamestateSnapshotsEnabled()
 {
     return false;
 }
+bool NetworkParallelRideRatingsEnabled()
+{
+    return false;
+}
 bool NetworkCheckDesynchronisation()
 {
     return false;
@@ -103,6 +103,7 @@ struct NetworkServerState
     uint32_t tick = 0;
     uint32_t srand0 = 0;
     bool gamestateSnapshotsEnabled = false;
+    bool parallelRideRatings = false;
 };
 
 // Structure is used for networking specific fields with meaning,
@@ -48,6 +48,7 @@ bool NetworkCheckDesynchronisation();
 void NetworkRequestGamestateSnapshot();
 void NetworkSendTick();
 bool NetworkGamestateSnapshotsEnabled();
+bool NetworkParallelRideRatingsEnabled();
 void NetworkUpdate();
 void NetworkProcessPending();
 void NetworkFlush();
@@ -19,6 +19,7 @@
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
 #include "../drawing/ImageImporter.h"
+#include "../profiling/Profiling.h"
 #include "../sprites.h"
 #include "Object.h"
 #include "ObjectFactory.h"
@@ -435,6 +436,15 @@ ImageTable::~ImageTable()
             delete[] entry.offset;
         }
     }
+    Profiling::TrackDeallocation(Profiling::MemoryTag::ImageTables, _trackedMemory);
+}
+
+void ImageTable::TrackMemory(size_t size)
+{
+    if (Profiling::TrackAllocation(Profiling::MemoryTag::ImageTables, size))
+    {
+        _trackedMemory += size;
+    }
 }
 
 void ImageTable::Read(IReadObjectContext* context, OpenRCT2::IStream* stream)
@@ -498,6 +508,7 @@ void ImageTable::Read(IReadObjectContext* context, OpenRCT2::IStream* stream)
 
         _data = std::move(data);
         _entries.insert(_entries.end(), newEntries.begin(), newEntries.end());
+        TrackMemory(dataSize + newEntries.size() * sizeof(G1Element));
     }
     catch (const std::exception&)
     {
@@ -622,4 +633,5 @@ void ImageTable::AddImage(const G1Element* g1)
         std::copy_n(g1->offset, length, newg1.offset);
     }
     _entries.push_back(std::move(newg1));
+    TrackMemory(length + sizeof(G1Element));
 }
@@ -29,6 +29,11 @@ private:
     std::unique_ptr<uint8_t[]> _data;
     std::vector<G1Element> _entries;
 
+    // Bytes reported to the memory tracker, released when the table is destroyed.
+    size_t _trackedMemory{};
+
+    void TrackMemory(size_t size);
+
     /**
      * Container for a G1 image, additional information and RAII. Used by ReadJson
      */
@@ -19,6 +19,7 @@
 #include "../localisation/Language.h"
 #include "../localisation/LocalisationService.h"
 #include "../localisation/StringIds.h"
+#include "../profiling/Profiling.h"
 #include "../world/Scenery.h"
 #include "ObjectLimits.h"
 #include "ObjectRepository.h"
@@ -140,6 +141,19 @@ bool ObjectEntryDescriptor::operator!=(const ObjectEntryDescriptor& rhs) const
     return !(*this == rhs);
 }
 
+Object::~Object()
+{
+    Profiling::TrackDeallocation(Profiling::MemoryTag::Objects, _trackedMemory);
+}
+
+void Object::TrackMemory(size_t size)
+{
+    if (Profiling::TrackAllocation(Profiling::MemoryTag::Objects, size))
+    {
+        _trackedMemory += size;
+    }
+}
+
 void* Object::GetLegacyData()
 {
     throw std::runtime_error("Not supported.");
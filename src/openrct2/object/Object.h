@@ -201,6 +201,9 @@ private:
     bool _isCompatibilityObject{};
     ImageIndex _baseImageId{ ImageIndexUndefined };
 
+    // Bytes reported to the memory tracker, released when the object is destroyed.
+    size_t _trackedMemory{};
+
 protected:
     StringTable& GetStringTable()
     {
@@ -227,7 +230,10 @@ protected:
     std::string GetString(int32_t language, ObjectStringID index) const;
 
 public:
-    virtual ~Object() = default;
+    virtual ~Object();
+
+    // Reports the size of the object instance to the memory tracker.
+    void TrackMemory(size_t size);
 
     std::string_view GetIdentifier() const
     {
@@ -322,63 +322,70 @@ namespace ObjectFactory
         return result;
     }
 
+    template<typename TObject> static std::unique_ptr<Object> MakeObject()
+    {
+        auto result = std::make_unique<TObject>();
+        result->TrackMemory(sizeof(TObject));
+        return result;
+    }
+
     std::unique_ptr<Object> CreateObject(ObjectType type)
     {
         std::unique_ptr<Object> result;
         switch (type)
         {
             case ObjectType::Ride:
-                result = std::make_unique<RideObject>();
+                result = MakeObject<RideObject>();
                 break;
             case ObjectType::SmallScenery:
-                result = std::make_unique<SmallSceneryObject>();
+                result = MakeObject<SmallSceneryObject>();
                 break;
             case ObjectType::LargeScenery:
-                result = std::make_unique<LargeSceneryObject>();
+                result = MakeObject<LargeSceneryObject>();
                 break;
             case ObjectType::Walls:
-                result = std::make_unique<WallObject>();
+                result = MakeObject<WallObject>();
                 break;
             case ObjectType::Banners:
-                result = std::make_unique<BannerObject>();
+                result = MakeObject<BannerObject>();
                 break;
             case ObjectType::Paths:
-                result = std::make_unique<FootpathObject>();
+                result = MakeObject<FootpathObject>();
                 break;
             case ObjectType::PathAdditions:
-                result = std::make_unique<PathAdditionObject>();
+                result = MakeObject<PathAdditionObject>();
                 break;
             case ObjectType::SceneryGroup:
-                result = std::make_unique<SceneryGroupObject>();
+                result = MakeObject<SceneryGroupObject>();
                 break;
             case ObjectType::ParkEntrance:
-                result = std::make_unique<EntranceObject>();
+                result = MakeObject<EntranceObject>();
                 break;
             case ObjectType::Water:
-                result = std::make_unique<WaterObject>();
+                result = MakeObject<WaterObject>();
                 break;
             case ObjectType::ScenarioText:
                 break;
             case ObjectType::TerrainSurface:
-                result = std::make_unique<TerrainSurfaceObject>();
+                result = MakeObject<TerrainSurfaceObject>();
                 break;
             case ObjectType::TerrainEdge:
-                result = std::make_unique<TerrainEdgeObject>();
+                result = MakeObject<TerrainEdgeObject>();
                 break;
             case ObjectType::Station:
-                result = std::make_unique<StationObject>();
+                result = MakeObject<StationObject>();
                 break;
             case ObjectType::Music:
-                result = std::make_unique<MusicObject>();
+                result = MakeObject<MusicObject>();
                 break;
             case ObjectType::FootpathSurface:
-                result = std::make_unique<FootpathSurfaceObject>();
+                result = MakeObject<FootpathSurfaceObject>();
                 break;
             case ObjectType::FootpathRailings:
-                result = std::make_unique<FootpathRailingsObject>();
+                result = MakeObject<FootpathRailingsObject>();
                 break;
             case ObjectType::Audio:
-                result = std::make_unique<AudioObject>();
+                result = MakeObject<AudioObject>();
                 break;
             default:
                 throw std::runtime_error("Invalid object type");
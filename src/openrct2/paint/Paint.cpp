@@ -1011,6 +1011,7 @@ PaintEntryPool::~PaintEntryPool()
         delete node;
     }
     _available.clear();
+    Profiling::TrackDeallocation(Profiling::MemoryTag::PaintPools, _numTrackedNodes * sizeof(Node));
 }
 
 PaintEntryPool::Node* PaintEntryPool::AllocateNode()
@@ -1026,6 +1027,10 @@ PaintEntryPool::Node* PaintEntryPool::AllocateNode()
     else
     {
         result = new (std::nothrow) PaintEntryPool::Node();
+        if (result != nullptr && Profiling::TrackAllocation(Profiling::MemoryTag::PaintPools, sizeof(Node)))
+        {
+            _numTrackedNodes++;
+        }
     }
     return result;
 }
@@ -166,6 +166,8 @@ public:
 
 private:
     std::vector<Node*> _available;
+    // Nodes that were counted by the memory profiler.
+    size_t _numTrackedNodes{};
     std::mutex _mutex;
 
     Node* AllocateNode();
@@ -27,6 +27,7 @@
 #    include <fnmatch.h>
 #    include <locale>
 #    include <pwd.h>
+#    include <sys/resource.h>
 #    include <sys/stat.h>
 #    include <sys/time.h>
 
@@ -305,6 +306,22 @@ namespace Platform
 #    endif // __EMSCRIPTEN__
     }
 
+    uint64_t GetPeakMemoryUsage()
+    {
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) != 0)
+        {
+            return 0;
+        }
+#    if defined(__APPLE__) && defined(__MACH__)
+        // macOS reports the maximum resident set size in bytes
+        return static_cast<uint64_t>(usage.ru_maxrss);
+#    else
+        // Other platforms report it in kilobytes
+        return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#    endif
+    }
+
     bool LockSingleInstance()
     {
         // We will never close this file manually. The operating system will
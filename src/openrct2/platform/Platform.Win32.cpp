@@ -17,6 +17,7 @@
 
 #    include <datetimeapi.h>
 #    include <lmcons.h>
+#    include <psapi.h>
 #    include <memory>
 #    include <shlobj.h>
 #    undef GetEnvironmentVariable
@@ -746,6 +747,16 @@ namespace Platform
         return isElevated;
     }
 
+    uint64_t GetPeakMemoryUsage()
+    {
+        PROCESS_MEMORY_COUNTERS counters{};
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        {
+            return static_cast<uint64_t>(counters.PeakWorkingSetSize);
+        }
+        return 0;
+    }
+
     std::string GetSteamPath()
     {
         wchar_t* wSteamPath;
@@ -71,6 +71,8 @@ namespace Platform
     bool FindApp(std::string_view app, std::string* output);
     int32_t Execute(std::string_view command, std::string* output = nullptr);
     bool ProcessIsElevated();
+    // Returns the peak resident memory of the process in bytes, or 0 if it is not available
+    uint64_t GetPeakMemoryUsage();
     float GetDefaultScale();
 
     bool IsRCT2Path(std::string_view path);
@@ -9,15 +9,25 @@
 
 #include "Profiling.h"
 
+#include "../Diagnostic.h"
+
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <fstream>
 #include <iomanip>
+#include <memory>
+#include <sstream>
 #include <stack>
+#include <thread>
 
 namespace OpenRCT2::Profiling
 {
     inline static bool _enabled = false;
+    static std::atomic<bool> _memoryTrackingEnabled = false;
+    static std::atomic<bool> _tracing = false;
+    static uint32_t _traceTicksRemaining;
+    static std::string _traceOutputPath;
 
     void Enable()
     {
@@ -55,10 +65,117 @@ namespace OpenRCT2::Profiling
 
         static thread_local std::stack<FunctionEntry> _callStack;
 
-        void FunctionEnter(Function& func)
+        enum class TraceEventType : uint8_t
+        {
+            Enter,
+            Exit,
+            Tick,
+        };
+
+        struct TraceEvent
+        {
+            const Function* Func;
+            Tp Time;
+            TraceEventType Type;
+        };
+
+        // ~6 MiB per thread, enough for a few hundred ticks of a busy park.
+        static constexpr size_t TraceBufferSize = 1 << 18;
+
+        // Written only by the owning thread, so recording an event needs no lock. Writing is set
+        // while an event is recorded, so recording can be paused and the thread waited for before
+        // the buffer is read or reset.
+        struct TraceBuffer
+        {
+            std::unique_ptr<TraceEvent[]> Events = std::make_unique<TraceEvent[]>(TraceBufferSize);
+            std::atomic<uint64_t> Count{};
+            std::atomic<bool> Writing{};
+            uint32_t ThreadIndex{};
+            // Whether a running thread records into the buffer, guarded by _traceBuffersMutex.
+            bool InUse{};
+        };
+
+        static std::mutex _traceBuffersMutex;
+        static std::vector<std::unique_ptr<TraceBuffer>> _traceBuffers;
+        static Tp _traceStartTime;
+
+        // Frees the buffer of a thread when it exits, so that short lived threads such as those of a
+        // job pool do not each keep a buffer. The events stay in the buffer and the next thread
+        // that takes it appends to them.
+        struct TraceBufferOwner
+        {
+            TraceBuffer* Buffer{};
+
+            ~TraceBufferOwner()
+            {
+                if (Buffer != nullptr)
+                {
+                    std::scoped_lock lock(_traceBuffersMutex);
+                    Buffer->InUse = false;
+                }
+            }
+        };
+        static thread_local TraceBufferOwner _traceBufferOwner;
+
+        static TraceBuffer& GetTraceBuffer()
+        {
+            auto& owner = _traceBufferOwner;
+            if (owner.Buffer == nullptr)
+            {
+                // Only taken the first time a thread records an event.
+                std::scoped_lock lock(_traceBuffersMutex);
+                auto it = std::find_if(
+                    _traceBuffers.begin(), _traceBuffers.end(), [](const auto& buffer) { return !buffer->InUse; });
+                if (it == _traceBuffers.end())
+                {
+                    auto buffer = std::make_unique<TraceBuffer>();
+                    buffer->ThreadIndex = static_cast<uint32_t>(_traceBuffers.size());
+                    it = _traceBuffers.insert(_traceBuffers.end(), std::move(buffer));
+                }
+                owner.Buffer = it->get();
+                owner.Buffer->InUse = true;
+            }
+            return *owner.Buffer;
+        }
+
+        static void RecordTraceEvent(const Function* func, TraceEventType type, const Tp& time)
+        {
+            auto& buffer = GetTraceBuffer();
+
+            // The mode may have been read before recording was paused, so check again once the
+            // pausing thread can see that this thread is writing.
+            buffer.Writing.store(true);
+            if (_tracing.load())
+            {
+                const auto index = buffer.Count.load(std::memory_order_relaxed);
+                buffer.Events[index % TraceBufferSize] = { func, time, type };
+                buffer.Count.store(index + 1, std::memory_order_relaxed);
+            }
+            buffer.Writing.store(false, std::memory_order_release);
+        }
+
+        ProfilingMode GetMode()
+        {
+            ProfilingMode mode = ModeNone;
+            if (_enabled)
+                mode |= ModeAggregate;
+            if (_tracing.load(std::memory_order_relaxed))
+                mode |= ModeTrace;
+            return mode;
+        }
+
+        void FunctionEnter(Function& func, ProfilingMode mode)
         {
             const auto entryTime = Clock::now();
 
+            if (mode & ModeTrace)
+            {
+                RecordTraceEvent(&func, TraceEventType::Enter, entryTime);
+            }
+
+            if (!(mode & ModeAggregate))
+                return;
+
             auto& funcInternal = static_cast<FunctionInternal&>(func);
             funcInternal.CallCount++;
 
@@ -70,10 +187,18 @@ namespace OpenRCT2::Profiling
             _callStack.emplace(parent, &funcInternal, entryTime);
         }
 
-        void FunctionExit(Function& func)
+        void FunctionExit(Function& func, ProfilingMode mode)
         {
             const auto exitTime = Clock::now();
 
+            if (mode & ModeTrace)
+            {
+                RecordTraceEvent(&func, TraceEventType::Exit, exitTime);
+            }
+
+            if (!(mode & ModeAggregate))
+                return;
+
             assert(!_callStack.empty());
 
             auto& stackEntry = _callStack.top();
@@ -120,8 +245,297 @@ namespace OpenRCT2::Profiling
             return Registry;
         }
 
+        struct MemoryCounters
+        {
+            // Signed as SetMemoryUsage may replace the usage while allocations are tracked.
+            std::atomic<int64_t> CurrentBytes{};
+            std::atomic<int64_t> PeakBytes{};
+            std::atomic<uint64_t> AllocationCount{};
+            std::atomic<uint64_t> AllocatedBytes{};
+
+            // Totals at the start of the current tick.
+            std::atomic<uint64_t> TickStartAllocationCount{};
+            std::atomic<uint64_t> TickStartAllocatedBytes{};
+
+            // Allocations made during the last completed tick.
+            std::atomic<uint64_t> TickAllocationCount{};
+            std::atomic<uint64_t> TickAllocatedBytes{};
+
+            void UpdatePeak(int64_t currentBytes)
+            {
+                auto peakBytes = PeakBytes.load(std::memory_order_relaxed);
+                while (currentBytes > peakBytes
+                       && !PeakBytes.compare_exchange_weak(peakBytes, currentBytes, std::memory_order_relaxed))
+                {
+                }
+            }
+        };
+
+        static std::array<MemoryCounters, static_cast<size_t>(MemoryTag::Count)> _memoryCounters;
+
+        static constexpr const char* MemoryTagNames[] = {
+            "tile_elements", "entities", "objects", "image_tables", "paint_pools", "scripting",
+        };
+        static_assert(std::size(MemoryTagNames) == static_cast<size_t>(MemoryTag::Count));
+
+        static MemoryCounters& GetMemoryCounters(MemoryTag tag)
+        {
+            return _memoryCounters[static_cast<size_t>(tag)];
+        }
+
     } // namespace Detail
 
+    void EnableMemoryTracking()
+    {
+        _memoryTrackingEnabled = true;
+    }
+
+    void DisableMemoryTracking()
+    {
+        _memoryTrackingEnabled = false;
+    }
+
+    bool IsMemoryTrackingEnabled()
+    {
+        return _memoryTrackingEnabled.load(std::memory_order_relaxed);
+    }
+
+    bool TrackAllocation(MemoryTag tag, size_t size)
+    {
+        if (!IsMemoryTrackingEnabled())
+            return false;
+
+        auto& counters = Detail::GetMemoryCounters(tag);
+        counters.AllocationCount.fetch_add(1, std::memory_order_relaxed);
+        counters.AllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+        auto currentBytes = counters.CurrentBytes.fetch_add(size, std::memory_order_relaxed) + static_cast<int64_t>(size);
+        counters.UpdatePeak(currentBytes);
+        return true;
+    }
+
+    void TrackDeallocation(MemoryTag tag, size_t size)
+    {
+        auto& counters = Detail::GetMemoryCounters(tag);
+        counters.CurrentBytes.fetch_sub(size, std::memory_order_relaxed);
+    }
+
+    void SetMemoryUsage(MemoryTag tag, size_t size)
+    {
+        auto& counters = Detail::GetMemoryCounters(tag);
+        const auto currentBytes = static_cast<int64_t>(size);
+        const auto previousBytes = counters.CurrentBytes.exchange(currentBytes, std::memory_order_relaxed);
+        if (IsMemoryTrackingEnabled() && currentBytes > previousBytes)
+        {
+            counters.AllocationCount.fetch_add(1, std::memory_order_relaxed);
+            counters.AllocatedBytes.fetch_add(currentBytes - previousBytes, std::memory_order_relaxed);
+        }
+        counters.UpdatePeak(currentBytes);
+    }
+
+    static void UpdateMemoryTick()
+    {
+        if (!IsMemoryTrackingEnabled())
+            return;
+
+        for (auto& counters : Detail::_memoryCounters)
+        {
+            auto allocationCount = counters.AllocationCount.load(std::memory_order_relaxed);
+            auto allocatedBytes = counters.AllocatedBytes.load(std::memory_order_relaxed);
+            counters.TickAllocationCount = allocationCount - counters.TickStartAllocationCount.exchange(allocationCount);
+            counters.TickAllocatedBytes = allocatedBytes - counters.TickStartAllocatedBytes.exchange(allocatedBytes);
+        }
+    }
+
+    std::vector<MemoryData> GetMemoryData()
+    {
+        std::vector<MemoryData> result;
+        for (size_t i = 0; i < Detail::_memoryCounters.size(); i++)
+        {
+            const auto& counters = Detail::_memoryCounters[i];
+
+            MemoryData data;
+            data.Tag = static_cast<MemoryTag>(i);
+            data.Name = Detail::MemoryTagNames[i];
+            data.CurrentBytes = static_cast<uint64_t>(std::max<int64_t>(0, counters.CurrentBytes.load()));
+            data.PeakBytes = static_cast<uint64_t>(std::max<int64_t>(0, counters.PeakBytes.load()));
+            data.AllocationCount = counters.AllocationCount.load();
+            data.TickAllocationCount = counters.TickAllocationCount.load();
+            data.TickAllocatedBytes = counters.TickAllocatedBytes.load();
+            result.push_back(data);
+        }
+        return result;
+    }
+
+    // Stops recording and waits for the threads that are still writing an event, returns whether
+    // recording was active.
+    static bool PauseTrace()
+    {
+        const bool wasTracing = _tracing.exchange(false);
+
+        std::scoped_lock lock(Detail::_traceBuffersMutex);
+        for (auto& buffer : Detail::_traceBuffers)
+        {
+            while (buffer->Writing.load())
+            {
+                std::this_thread::yield();
+            }
+        }
+        return wasTracing;
+    }
+
+    void StartTrace(uint32_t numTicks, const std::string& outputPath)
+    {
+        StopTrace();
+
+        {
+            std::scoped_lock lock(Detail::_traceBuffersMutex);
+            for (auto& buffer : Detail::_traceBuffers)
+            {
+                buffer->Count = 0;
+            }
+        }
+
+        _traceTicksRemaining = numTicks;
+        _traceOutputPath = outputPath;
+        Detail::_traceStartTime = Detail::Clock::now();
+        _tracing = true;
+    }
+
+    void StopTrace()
+    {
+        if (!PauseTrace())
+            return;
+
+        if (!_traceOutputPath.empty())
+        {
+            if (ExportTrace(_traceOutputPath))
+                LOG_INFO("Wrote profiler trace to %s", _traceOutputPath.c_str());
+            else
+                LOG_ERROR("Unable to write profiler trace to %s", _traceOutputPath.c_str());
+            _traceOutputPath.clear();
+        }
+    }
+
+    bool IsTracing()
+    {
+        return _tracing.load(std::memory_order_relaxed);
+    }
+
+    static void UpdateTraceTick()
+    {
+        if (!IsTracing())
+            return;
+
+        Detail::RecordTraceEvent(nullptr, Detail::TraceEventType::Tick, Detail::Clock::now());
+        if (_traceTicksRemaining > 0 && --_traceTicksRemaining == 0)
+        {
+            StopTrace();
+        }
+    }
+
+    void Tick()
+    {
+        UpdateMemoryTick();
+        UpdateTraceTick();
+    }
+
+    static void WriteTraceString(std::ostream& out, const char* str)
+    {
+        out << '"';
+        for (; *str != '\0'; str++)
+        {
+            if (*str == '"' || *str == '\\')
+                out << '\\';
+            out << *str;
+        }
+        out << '"';
+    }
+
+    static void WriteTrace(std::ostream& out)
+    {
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        out << std::fixed << std::setprecision(3);
+
+        bool first = true;
+        auto beginEvent = [&]() -> std::ostream& {
+            if (!first)
+                out << ",\n";
+            first = false;
+            return out;
+        };
+
+        std::scoped_lock lock(Detail::_traceBuffersMutex);
+        uint32_t tick = 0;
+        for (const auto& buffer : Detail::_traceBuffers)
+        {
+            const auto count = buffer->Count.load(std::memory_order_relaxed);
+            if (count == 0)
+                continue;
+
+            const auto tid = buffer->ThreadIndex;
+            beginEvent() << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << tid
+                         << ",\"args\":{\"name\":\"Thread " << tid << "\"}}";
+
+            // Exits of calls that were entered before the oldest event still in the buffer are skipped.
+            size_t depth = 0;
+            const auto start = count > Detail::TraceBufferSize ? count - Detail::TraceBufferSize : 0;
+            for (auto i = start; i < count; i++)
+            {
+                const auto& event = buffer->Events[i % Detail::TraceBufferSize];
+                const auto timeUs = std::chrono::duration<double, std::micro>(event.Time - Detail::_traceStartTime).count();
+                switch (event.Type)
+                {
+                    case Detail::TraceEventType::Enter:
+                        depth++;
+                        WriteTraceString(beginEvent() << "{\"name\":", event.Func->GetName());
+                        out << ",\"ph\":\"B\",\"ts\":" << timeUs << ",\"pid\":1,\"tid\":" << tid << "}";
+                        break;
+                    case Detail::TraceEventType::Exit:
+                        if (depth == 0)
+                            break;
+                        depth--;
+                        beginEvent() << "{\"ph\":\"E\",\"ts\":" << timeUs << ",\"pid\":1,\"tid\":" << tid << "}";
+                        break;
+                    case Detail::TraceEventType::Tick:
+                        beginEvent() << "{\"name\":\"Tick " << tick++ << "\",\"ph\":\"i\",\"s\":\"g\",\"ts\":" << timeUs
+                                     << ",\"pid\":1,\"tid\":" << tid << "}";
+                        break;
+                }
+            }
+        }
+
+        out << "\n]}\n";
+    }
+
+    // Recording is paused while the buffers are read, as the threads would otherwise overwrite
+    // the events that are being written out.
+    static void WritePausedTrace(std::ostream& out)
+    {
+        const bool wasTracing = PauseTrace();
+        WriteTrace(out);
+        if (wasTracing)
+        {
+            _tracing = true;
+        }
+    }
+
+    bool ExportTrace(const std::string& filePath)
+    {
+        std::ofstream out(filePath);
+        if (!out.is_open())
+            return false;
+
+        WritePausedTrace(out);
+        return out.good();
+    }
+
+    std::string GetTrace()
+    {
+        std::ostringstream out;
+        WritePausedTrace(out);
+        return out.str();
+    }
+
     const std::vector<Function*>& GetData()
     {
         return Detail::GetRegistry();
@@ -141,6 +555,17 @@ namespace OpenRCT2::Profiling
             funcInternal->Children.clear();
             funcInternal->Parents.clear();
         }
+
+        for (auto& counters : Detail::_memoryCounters)
+        {
+            counters.PeakBytes = counters.CurrentBytes.load();
+            counters.AllocationCount = 0;
+            counters.AllocatedBytes = 0;
+            counters.TickStartAllocationCount = 0;
+            counters.TickStartAllocatedBytes = 0;
+            counters.TickAllocationCount = 0;
+            counters.TickAllocatedBytes = 0;
+        }
     }
 
     bool ExportCSV(const std::string& filePath)
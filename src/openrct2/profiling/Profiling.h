@@ -154,35 +154,46 @@ namespace OpenRCT2::Profiling
             static inline FunctionWrapper<TName> Data;
         };
 
-        void FunctionEnter(Function& func);
-        void FunctionExit(Function& func);
+        // What is recorded for a profiled function call, captured on entry so enter and exit match.
+        using ProfilingMode = uint8_t;
+        static constexpr ProfilingMode ModeNone = 0;
+        static constexpr ProfilingMode ModeAggregate = 1 << 0;
+        static constexpr ProfilingMode ModeTrace = 1 << 1;
+
+        ProfilingMode GetMode();
+
+        void FunctionEnter(Function& func, ProfilingMode mode);
+        void FunctionExit(Function& func, ProfilingMode mode);
 
     } // namespace Detail
 
     template<typename T> class ScopedProfiling
     {
-        bool _enabled;
+        Detail::ProfilingMode _mode;
         T& _func;
 
     public:
         ScopedProfiling(T& func)
-            : _enabled{ IsEnabled() }
+            : _mode{ Detail::GetMode() }
             , _func(func)
         {
-            if (_enabled)
+            if (_mode != Detail::ModeNone)
             {
-                Detail::FunctionEnter(_func);
+                Detail::FunctionEnter(_func, _mode);
             }
         }
         ~ScopedProfiling()
         {
-            if (!_enabled)
+            if (_mode == Detail::ModeNone)
                 return;
-            Detail::FunctionExit(_func);
+            Detail::FunctionExit(_func, _mode);
         }
     };
 
-    // Clears all the current data of each function.
+    // Called once per game tick, closes the allocation window of the tick and advances the trace.
+    void Tick();
+
+    // Clears all the current data of each function, peak memory and allocation counts.
     void ResetData();
 
     // Returns all functions.
@@ -190,4 +201,68 @@ namespace OpenRCT2::Profiling
 
     bool ExportCSV(const std::string& filePath);
 
+    // Starts recording every profiled function call into per thread ring buffers for the given
+    // number of game ticks, or until StopTrace is called when numTicks is 0. When outputPath is
+    // given the trace is exported to it once recording stops. Independent of Enable/Disable.
+    void StartTrace(uint32_t numTicks, const std::string& outputPath = {});
+    void StopTrace();
+    bool IsTracing();
+
+    // Exports the last recorded trace in the Chrome trace event format, which can be opened in
+    // chrome://tracing or ui.perfetto.dev.
+    bool ExportTrace(const std::string& filePath);
+    std::string GetTrace();
+
+    // Subsystems that report the memory they own.
+    enum class MemoryTag : uint8_t
+    {
+        TileElements,
+        Entities,
+        Objects,
+        ImageTables,
+        PaintPools,
+        Scripting,
+        Count,
+    };
+
+    struct MemoryData
+    {
+        MemoryTag Tag{};
+
+        const char* Name{};
+
+        // Bytes currently owned by the subsystem.
+        uint64_t CurrentBytes{};
+
+        // Highest value of CurrentBytes since the data was last reset.
+        uint64_t PeakBytes{};
+
+        // Allocations made since the data was last reset.
+        uint64_t AllocationCount{};
+
+        // Allocations and bytes allocated during the last completed tick.
+        uint64_t TickAllocationCount{};
+        uint64_t TickAllocatedBytes{};
+    };
+
+    // Memory tracking is opt-in and independent of function profiling, allocations made while
+    // it is disabled are not counted.
+    void EnableMemoryTracking();
+    void DisableMemoryTracking();
+    bool IsMemoryTrackingEnabled();
+
+    // Returns false if the allocation was not counted because memory tracking is disabled.
+    bool TrackAllocation(MemoryTag tag, size_t size);
+
+    // Must only be called for allocations that were counted. It is applied even if memory
+    // tracking has been disabled since, so that the totals stay balanced.
+    void TrackDeallocation(MemoryTag tag, size_t size);
+
+    // For subsystems that own a few large buffers, replaces the current usage instead of
+    // tracking each allocation. This is applied even when memory tracking is disabled.
+    void SetMemoryUsage(MemoryTag tag, size_t size);
+
+    // Returns the memory data of each tag.
+    std::vector<MemoryData> GetMemoryData();
+
 } // namespace OpenRCT2::Profiling
@@ -11,9 +11,14 @@
 
 #include "../Cheats.h"
 #include "../Context.h"
+#include "../Game.h"
 #include "../OpenRCT2.h"
+#include "../ReplayManager.h"
+#include "../config/Config.h"
+#include "../core/JobPool.h"
 #include "../interface/Window.h"
 #include "../localisation/Date.h"
+#include "../network/network.h"
 #include "../profiling/Profiling.h"
 #include "../scripting/ScriptEngine.h"
 #include "../world/Footpath.h"
@@ -26,6 +31,8 @@
 
 #include <algorithm>
 #include <iterator>
+#include <memory>
+#include <vector>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Scripting;
@@ -84,7 +91,13 @@ static RideRatingUpdateStates gRideRatingUpdateStates;
 // would be currently 80, this is the worst case of sub-steps and may break out earlier.
 static constexpr size_t MaxRideRatingUpdateSubSteps = 20;
 
+// Ticks between the batches of rides that are rated on worker threads, one second of game time.
+static constexpr uint32_t RideRatingsBatchInterval = 40;
+
+static std::unique_ptr<JobPool> _rideRatingsJobs;
+
 static void ride_ratings_update_state(RideRatingUpdateState& state);
+static bool ShouldSkipRatingCalculation(const Ride& ride);
 static void ride_ratings_update_state_0(RideRatingUpdateState& state);
 static void ride_ratings_update_state_1(RideRatingUpdateState& state);
 static void ride_ratings_update_state_2(RideRatingUpdateState& state);
@@ -185,6 +198,79 @@ void RideRatingsUpdateRide(const Ride& ride)
     }
 }
 
+static bool RideRatingsUseWorkerThreads()
+{
+    // Replays do not store the mode, so they are always recorded and played back with the incremental update
+    auto* replayManager = OpenRCT2::GetContext()->GetReplayManager();
+    if (replayManager != nullptr
+        && (replayManager->IsRecording() || replayManager->IsReplaying() || replayManager->IsNormalising()))
+        return false;
+
+    // Peers have to agree on the mode as it changes on which ticks the ratings are updated
+    if (NetworkGetMode() != NETWORK_MODE_NONE)
+        return NetworkParallelRideRatingsEnabled();
+    return gConfigGeneral.ParallelRideRatings;
+}
+
+/**
+ * Rates every ride at once instead of a few track pieces per tick. Walking the track only reads the map and the rides,
+ * which do not change while the main thread waits for the workers, so each ride is walked on a worker thread. The
+ * ratings are then applied in ride order on the tick the batch started, which keeps the game state deterministic.
+ */
+static void RideRatingsUpdateAllInParallel()
+{
+    if (gCurrentTicks % RideRatingsBatchInterval != 0)
+        return;
+
+    // Rides left half way by the incremental update would otherwise be skipped
+    RideRatingResetUpdateStates();
+
+    std::vector<RideRatingUpdateState> states;
+    for (const auto& ride : GetRideManager())
+    {
+        if (ShouldSkipRatingCalculation(ride))
+            continue;
+
+        auto& state = states.emplace_back();
+        state.CurrentRide = ride.id;
+        state.State = RIDE_RATINGS_STATE_INITIALISE;
+    }
+
+    if (_rideRatingsJobs == nullptr)
+    {
+        _rideRatingsJobs = std::make_unique<JobPool>();
+    }
+
+    // Each step visits one track element and the track is walked twice, a track that never returns to where the walk
+    // started (which cheats allow) would otherwise be walked forever.
+    const size_t maxSteps = 2 * GetActiveMapState().TileElementsInUse + 8;
+    for (auto& state : states)
+    {
+        _rideRatingsJobs->AddTask([&state, maxSteps]() {
+            for (size_t i = 0; i < maxSteps; i++)
+            {
+                if (state.State == RIDE_RATINGS_STATE_FIND_NEXT_RIDE || state.State == RIDE_RATINGS_STATE_CALCULATE)
+                    return;
+                ride_ratings_update_state(state);
+            }
+        });
+    }
+    _rideRatingsJobs->Join();
+
+    for (auto& state : states)
+    {
+        if (state.State == RIDE_RATINGS_STATE_CALCULATE)
+        {
+            ride_ratings_update_state(state);
+        }
+        else if (state.State != RIDE_RATINGS_STATE_FIND_NEXT_RIDE)
+        {
+            // The ride keeps its previous ratings
+            LOG_VERBOSE("Unable to rate ride %u, its track could not be walked", state.CurrentRide.ToUnderlying());
+        }
+    }
+}
+
 /**
  *
  *  rct2: 0x006B5A2A
@@ -196,6 +282,12 @@ void RideRatingsUpdateAll()
     if (gScreenFlags & SCREEN_FLAGS_SCENARIO_EDITOR)
         return;
 
+    if (RideRatingsUseWorkerThreads())
+    {
+        RideRatingsUpdateAllInParallel();
+        return;
+    }
+
     for (auto& updateState : gRideRatingUpdateStates)
     {
         for (size_t i = 0; i < MaxRideRatingUpdateSubSteps; ++i)
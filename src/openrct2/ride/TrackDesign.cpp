@@ -29,6 +29,7 @@
 #include "../actions/WallPlaceAction.h"
 #include "../actions/WallRemoveAction.h"
 #include "../audio/audio.h"
+#include "../core/Crypt.h"
 #include "../core/DataSerialiser.h"
 #include "../core/File.h"
 #include "../core/Numerics.hpp"
@@ -62,12 +63,14 @@
 #include "Track.h"
 #include "TrackData.h"
 #include "TrackDesign.h"
+#include "TrackDesignPreviewCache.h"
 #include "TrackDesignRepository.h"
 #include "Vehicle.h"
 
 #include <algorithm>
 #include <iterator>
 #include <memory>
+#include <optional>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
@@ -2004,6 +2007,15 @@ static money64 TrackDesignCreateRide(int32_t type, int32_t subType, int32_t flag
  * ebx = ride_id
  * cost = edi
  */
+static bool TrackDesignIsVehicleUnavailable(const TrackDesign& td6)
+{
+    auto& objManager = GetContext()->GetObjectManager();
+    auto entryIndex = objManager.GetLoadedObjectEntryIndex(td6.vehicle_object);
+    if (entryIndex == OBJECT_ENTRY_INDEX_NULL)
+        return true;
+    return !RideEntryIsInvented(entryIndex) && !gCheatsIgnoreResearchStatus;
+}
+
 static bool TrackDesignPlacePreview(TrackDesignState& tds, TrackDesign* td6, money64* cost, Ride** outRide, uint8_t* flags)
 {
     *outRide = nullptr;
@@ -2080,11 +2092,7 @@ static bool TrackDesignPlacePreview(TrackDesignState& tds, TrackDesign* td6, mon
 
     if (res.Error == GameActions::Status::Ok)
     {
-        if (entry_index == OBJECT_ENTRY_INDEX_NULL)
-        {
-            *flags |= TRACK_DESIGN_FLAG_VEHICLE_UNAVAILABLE;
-        }
-        else if (!RideEntryIsInvented(entry_index) && !gCheatsIgnoreResearchStatus)
+        if (TrackDesignIsVehicleUnavailable(*td6))
         {
             *flags |= TRACK_DESIGN_FLAG_VEHICLE_UNAVAILABLE;
         }
@@ -2108,16 +2116,36 @@ static bool TrackDesignPlacePreview(TrackDesignState& tds, TrackDesign* td6, mon
  *
  *  rct2: 0x006D1EF0
  */
-void TrackDesignDrawPreview(TrackDesign* td6, uint8_t* pixels)
+void TrackDesignDrawPreview(TrackDesign* td6, uint8_t* pixels, u8string_view path)
 {
-    StashMap();
-    TrackDesignPreviewClearMap();
-
     if (gScreenFlags & SCREEN_FLAGS_TRACK_MANAGER)
     {
         TrackDesignLoadSceneryObjects(td6);
     }
 
+    // A cached preview also has the cost and flags, so the design does not have to be placed
+    u8string cacheKey;
+    if (!path.empty())
+    {
+        cacheKey = TrackDesignPreviewCache::GetKey(path, *td6);
+        TrackDesignPreviewCache::Entry entry;
+        if (!cacheKey.empty() && TrackDesignPreviewCache::Load(cacheKey, entry, pixels))
+        {
+            // Whether the vehicle is invented depends on the park
+            td6->cost = entry.Cost;
+            td6->track_flags = entry.TrackFlags & ~TRACK_DESIGN_FLAG_VEHICLE_UNAVAILABLE;
+            if (TrackDesignIsVehicleUnavailable(*td6))
+            {
+                td6->track_flags |= TRACK_DESIGN_FLAG_VEHICLE_UNAVAILABLE;
+            }
+            return;
+        }
+    }
+
+    MapState previewMapState;
+    ScopedActiveMapState activeMapState(previewMapState);
+    TrackDesignPreviewClearMap();
+
     TrackDesignState tds{};
 
     money64 cost;
@@ -2126,7 +2154,6 @@ void TrackDesignDrawPreview(TrackDesign* td6, uint8_t* pixels)
     if (!TrackDesignPlacePreview(tds, td6, &cost, &ride, &flags))
     {
         std::fill_n(pixels, TRACK_PREVIEW_IMAGE_SIZE * 4, 0x00);
-        UnstashMap();
         return;
     }
     td6->cost = cost;
@@ -2198,8 +2225,113 @@ void TrackDesignDrawPreview(TrackDesign* td6, uint8_t* pixels)
         dpi.bits += TRACK_PREVIEW_IMAGE_SIZE;
     }
 
+    if (!cacheKey.empty())
+    {
+        TrackDesignPreviewCache::Save(cacheKey, { td6->cost, td6->track_flags }, pixels);
+    }
+
+    ride->Delete();
+}
+
+/**
+ * Copies the measurements stored in the design back to the ride, the reverse of TrackDesign::CreateTrackDesign.
+ */
+static void TrackDesignApplyMeasurements(const TrackDesign& td6, Ride& ride)
+{
+    ride.mode = static_cast<RideMode>(td6.ride_mode);
+    ride.operation_option = td6.operation_setting;
+    ride.NumTrains = td6.number_of_trains;
+    ride.num_cars_per_train = td6.number_of_cars_per_train;
+    ride.proposed_num_cars_per_train = td6.number_of_cars_per_train;
+
+    ride.max_speed = td6.max_speed * 65536;
+    ride.average_speed = td6.average_speed * 65536;
+    ride.max_positive_vertical_g = td6.max_positive_vertical_g * 32;
+    ride.max_negative_vertical_g = td6.max_negative_vertical_g * 32;
+    ride.max_lateral_g = td6.max_lateral_g * 32;
+    ride.holes = td6.holes & 0x1F;
+    ride.inversions = td6.inversions & 0x1F;
+    ride.sheltered_eighths = td6.inversions >> 5;
+    ride.drops = td6.drops;
+    ride.highest_drop_height = td6.highest_drop_height;
+    ride.total_air_time = (td6.total_air_time * 1024) / 123;
+
+    // Only the total length is stored, so it is given to the first station
+    for (auto& station : ride.GetStations())
+    {
+        station.SegmentLength = 0;
+    }
+    for (auto& station : ride.GetStations())
+    {
+        if (!station.Start.IsNull())
+        {
+            station.SegmentLength = td6.ride_length * 65536;
+            break;
+        }
+    }
+
+    ride.lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
+}
+
+/**
+ * Places the design on a preview map and runs the ride ratings to completion. Measurements that are not stored in
+ * designs, such as the number of turns and the station lengths, are zero so the result is an estimate that can differ
+ * from the ratings of the ride once it is built and tested.
+ */
+std::optional<RatingTuple> TrackDesignEstimateRatings(TrackDesign* td6)
+{
+    MapState previewMapState;
+    ScopedActiveMapState activeMapState(previewMapState);
+    TrackDesignPreviewClearMap();
+
+    if (gScreenFlags & SCREEN_FLAGS_TRACK_MANAGER)
+    {
+        TrackDesignLoadSceneryObjects(td6);
+    }
+
+    TrackDesignState tds{};
+
+    money64 cost;
+    Ride* ride;
+    uint8_t flags;
+    if (!TrackDesignPlacePreview(tds, td6, &cost, &ride, &flags))
+    {
+        return std::nullopt;
+    }
+
+    TrackDesignApplyMeasurements(*td6, *ride);
+    ride->status = RideStatus::Open;
+    RideRatingsUpdateRide(*ride);
+    auto ratings = ride->ratings;
+
     ride->Delete();
-    UnstashMap();
+
+    if (ratings.Excitement == RIDE_RATING_UNDEFINED)
+        return std::nullopt;
+    return ratings;
+}
+
+u8string TrackDesignGetFileHash(u8string_view path)
+{
+    try
+    {
+        auto data = File::ReadAllBytes(path);
+        auto hash = Crypt::SHA1(data.data(), data.size());
+
+        u8string result;
+        char hex[3];
+        for (auto b : hash)
+        {
+            snprintf(hex, sizeof(hex), "%02x", b);
+            result += hex;
+        }
+        return result;
+    }
+    catch (const std::exception& e)
+    {
+        LOG_VERBOSE("Unable to hash track design %s: %s", u8string(path).c_str(), e.what());
+        return {};
+    }
 }
 
 /**
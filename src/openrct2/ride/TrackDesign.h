@@ -15,9 +15,11 @@
 #include "../rct12/RCT12.h"
 #include "../rct2/RCT2.h"
 #include "../world/Map.h"
+#include "RideRatings.h"
 #include "VehicleColour.h"
 
 #include <memory>
+#include <optional>
 
 struct Ride;
 struct ResultWithMessage;
@@ -231,7 +233,17 @@ int32_t TrackDesignGetZPlacement(TrackDesign* td6, Ride& ride, const CoordsXYZD&
 ///////////////////////////////////////////////////////////////////////////////
 // Track design preview
 ///////////////////////////////////////////////////////////////////////////////
-void TrackDesignDrawPreview(TrackDesign* td6, uint8_t* pixels);
+// If path is given, the rendered preview is cached on disk for that design file.
+void TrackDesignDrawPreview(TrackDesign* td6, uint8_t* pixels, u8string_view path = {});
+
+///////////////////////////////////////////////////////////////////////////////
+// Track design ratings
+///////////////////////////////////////////////////////////////////////////////
+// Designs do not store every measurement the ratings use, so these can differ from the ratings of the built ride.
+[[nodiscard]] std::optional<RatingTuple> TrackDesignEstimateRatings(TrackDesign* td6);
+
+// Returns the SHA1 of the design file as hex, or an empty string if the file can not be read.
+[[nodiscard]] u8string TrackDesignGetFileHash(u8string_view path);
 
 ///////////////////////////////////////////////////////////////////////////////
 // Track design saving
@@ -0,0 +1,247 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TrackDesignPreviewCache.h"
+
+#include "../Context.h"
+#include "../Diagnostic.h"
+#include "../PlatformEnvironment.h"
+#include "../Version.h"
+#include "../core/Crypt.h"
+#include "../core/File.h"
+#include "../core/Path.hpp"
+#include "../object/ObjectManager.h"
+#include "../util/Util.h"
+#include "TrackDesign.h"
+
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace OpenRCT2;
+
+namespace TrackDesignPreviewCache
+{
+    constexpr uint32_t Magic = 0x56504454; // TDPV
+    // Increase this when the preview rendering changes so old entries are no longer used.
+    constexpr uint32_t Version = 2;
+    // Magic, version, cost and track flags.
+    constexpr size_t HeaderSize = sizeof(uint32_t) + sizeof(uint32_t) + sizeof(int64_t) + sizeof(uint8_t);
+    constexpr size_t PixelsSize = 4 * TRACK_PREVIEW_IMAGE_SIZE;
+
+    /**
+     * Compresses and writes the entries on a single thread, which keeps the writes in order and away from the threads
+     * used for drawing.
+     */
+    class EntryWriter
+    {
+    private:
+        struct PendingEntry
+        {
+            u8string Path;
+            std::vector<uint8_t> Data;
+        };
+
+        std::mutex _mutex;
+        std::condition_variable _pendingChanged;
+        std::deque<PendingEntry> _pending;
+        bool _isWriting{};
+        bool _stop{};
+        std::thread _thread;
+
+    public:
+        ~EntryWriter()
+        {
+            Shutdown();
+        }
+
+        void Add(u8string&& path, std::vector<uint8_t>&& data)
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _pending.push_back({ std::move(path), std::move(data) });
+                if (!_thread.joinable())
+                {
+                    _stop = false;
+                    _thread = std::thread([this]() { Run(); });
+                }
+            }
+            _pendingChanged.notify_all();
+        }
+
+        // Writes the pending entries and stops the thread, it is started again by the next entry.
+        void Shutdown()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stop = true;
+            }
+            _pendingChanged.notify_all();
+            if (_thread.joinable())
+            {
+                _thread.join();
+            }
+        }
+
+    private:
+        void Run()
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            while (true)
+            {
+                _pendingChanged.wait(lock, [this]() { return _stop || !_pending.empty(); });
+                if (_pending.empty())
+                    break;
+
+                auto entry = std::move(_pending.front());
+                _pending.pop_front();
+                lock.unlock();
+                Write(entry.Path, entry.Data);
+                lock.lock();
+            }
+        }
+
+        static void Write(const u8string& path, const std::vector<uint8_t>& data)
+        {
+            try
+            {
+                Path::CreateDirectory(Path::GetDirectory(path));
+
+                // Write to a temporary file first so a preview that is being read is never incomplete
+                auto compressed = Gzip(data.data(), data.size());
+                auto tempPath = path + u8".tmp";
+                File::WriteAllBytes(tempPath, compressed.data(), compressed.size());
+                File::Delete(path);
+                File::Move(tempPath, path);
+            }
+            catch (const std::exception& e)
+            {
+                LOG_WARNING("Unable to write track design preview %s: %s", path.c_str(), e.what());
+            }
+        }
+    };
+
+    static EntryWriter _entryWriter;
+
+    static u8string GetDirectory()
+    {
+        auto env = GetContext()->GetPlatformEnvironment();
+        return Path::Combine(env->GetDirectoryPath(DIRBASE::CACHE), u8"track_previews");
+    }
+
+    static u8string GetPath(u8string_view key)
+    {
+        return Path::Combine(GetDirectory(), u8string(key) + u8".bin");
+    }
+
+    static void AddLoadedObject(Crypt::Sha1Algorithm& hash, const ObjectEntryDescriptor& descriptor)
+    {
+        // Which objects are missing changes what is drawn as well
+        u8string version = u8"missing";
+        auto* obj = ObjectManagerGetLoadedObject(descriptor);
+        if (obj != nullptr)
+        {
+            version = VersionString(obj->GetVersion());
+        }
+
+        auto name = descriptor.ToString();
+        hash.Update(name.data(), name.size() + 1);
+        hash.Update(version.data(), version.size() + 1);
+    }
+
+    u8string GetKey(u8string_view path, const TrackDesign& td6)
+    {
+        auto fileHash = TrackDesignGetFileHash(path);
+        if (fileHash.empty())
+            return fileHash;
+
+        // Previews drawn by another build or with other versions of the objects may look different
+        auto hash = Crypt::CreateSHA1();
+        hash->Update(fileHash.data(), fileHash.size());
+        hash->Update(gVersionInfoFull, std::strlen(gVersionInfoFull) + 1);
+        AddLoadedObject(*hash, td6.vehicle_object);
+        for (const auto& scenery : td6.scenery_elements)
+        {
+            AddLoadedObject(*hash, scenery.scenery_object);
+        }
+
+        u8string key;
+        char hex[3];
+        for (auto b : hash->Finish())
+        {
+            snprintf(hex, sizeof(hex), "%02x", b);
+            key += hex;
+        }
+        return key;
+    }
+
+    bool Load(u8string_view key, Entry& entry, uint8_t* pixels)
+    {
+        auto path = GetPath(key);
+        if (!File::Exists(path))
+            return false;
+
+        try
+        {
+            auto compressed = File::ReadAllBytes(path);
+            auto data = Ungzip(compressed.data(), compressed.size());
+            if (data.size() != HeaderSize + PixelsSize)
+                return false;
+
+            const auto* src = data.data();
+            uint32_t magic;
+            uint32_t version;
+            int64_t cost;
+            std::memcpy(&magic, src, sizeof(magic));
+            src += sizeof(magic);
+            std::memcpy(&version, src, sizeof(version));
+            src += sizeof(version);
+            if (magic != Magic || version != Version)
+                return false;
+
+            std::memcpy(&cost, src, sizeof(cost));
+            src += sizeof(cost);
+            entry.Cost = cost;
+            entry.TrackFlags = *src++;
+
+            std::memcpy(pixels, src, PixelsSize);
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            LOG_WARNING("Unable to read track design preview %s: %s", path.c_str(), e.what());
+            return false;
+        }
+    }
+
+    void Save(u8string_view key, const Entry& entry, const uint8_t* pixels)
+    {
+        std::vector<uint8_t> data(HeaderSize + PixelsSize);
+        auto* dst = data.data();
+        const int64_t cost = entry.Cost;
+        std::memcpy(dst, &Magic, sizeof(Magic));
+        dst += sizeof(Magic);
+        std::memcpy(dst, &Version, sizeof(Version));
+        dst += sizeof(Version);
+        std::memcpy(dst, &cost, sizeof(cost));
+        dst += sizeof(cost);
+        *dst++ = entry.TrackFlags;
+        std::memcpy(dst, pixels, PixelsSize);
+
+        _entryWriter.Add(GetPath(key), std::move(data));
+    }
+
+    void Shutdown()
+    {
+        _entryWriter.Shutdown();
+    }
+} // namespace TrackDesignPreviewCache
@@ -0,0 +1,44 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "../core/String.hpp"
+
+#include <cstdint>
+
+struct TrackDesign;
+
+/**
+ * Caches the four rotations of rendered track design previews on disk, along with the cost and track flags found when
+ * the design was placed, so that a cached design does not have to be placed again. Entries are keyed by a hash of the
+ * design file, the game version and the versions of the objects it uses. Entries are compressed and written on a
+ * background thread so that saving a preview does not hold up the UI.
+ */
+namespace TrackDesignPreviewCache
+{
+    struct Entry
+    {
+        money64 Cost{};
+        uint8_t TrackFlags{};
+    };
+
+    // Returns the key for the given design file, or an empty string if the file can not be read. The objects of the
+    // design have to be loaded already.
+    u8string GetKey(u8string_view path, const TrackDesign& td6);
+
+    // Reads a cached preview of 4 * TRACK_PREVIEW_IMAGE_SIZE pixels, returns false if there is no valid entry.
+    bool Load(u8string_view key, Entry& entry, uint8_t* pixels);
+
+    void Save(u8string_view key, const Entry& entry, const uint8_t* pixels);
+
+    // Writes the entries that are still pending.
+    void Shutdown();
+} // namespace TrackDesignPreviewCache
@@ -0,0 +1,125 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TrackDesignRatingsCache.h"
+
+#include "../Context.h"
+#include "../Diagnostic.h"
+#include "../PlatformEnvironment.h"
+#include "../core/File.h"
+#include "../core/Json.hpp"
+#include "../core/Path.hpp"
+
+#include <unordered_map>
+
+using namespace OpenRCT2;
+
+namespace TrackDesignRatingsCache
+{
+    // Increase this when the ratings calculation changes so old entries are no longer used.
+    constexpr int32_t Version = 1;
+
+    static std::unordered_map<u8string, RatingTuple> _ratings;
+    static bool _loaded;
+    static bool _dirty;
+
+    static u8string GetPath()
+    {
+        auto env = GetContext()->GetPlatformEnvironment();
+        return Path::Combine(env->GetDirectoryPath(DIRBASE::CACHE), u8"track_ratings.json");
+    }
+
+    static void Load()
+    {
+        _loaded = true;
+
+        auto path = GetPath();
+        if (!File::Exists(path))
+            return;
+
+        try
+        {
+            auto jsonCache = Json::ReadFromFile(path);
+            if (Json::GetNumber<int32_t>(jsonCache["version"]) != Version)
+                return;
+
+            const auto& jsonRatings = jsonCache["ratings"];
+            for (auto it = jsonRatings.begin(); it != jsonRatings.end(); it++)
+            {
+                const auto& value = it.value();
+                if (!value.is_array() || value.size() != 3)
+                    continue;
+
+                RatingTuple ratings{};
+                ratings.Excitement = Json::GetNumber<ride_rating>(value[0]);
+                ratings.Intensity = Json::GetNumber<ride_rating>(value[1]);
+                ratings.Nausea = Json::GetNumber<ride_rating>(value[2]);
+                _ratings[it.key()] = ratings;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            LOG_WARNING("Unable to read track design ratings %s: %s", path.c_str(), e.what());
+            _ratings.clear();
+        }
+    }
+
+    std::optional<RatingTuple> Get(u8string_view hash)
+    {
+        if (!_loaded)
+        {
+            Load();
+        }
+
+        auto it = _ratings.find(u8string(hash));
+        if (it == _ratings.end())
+            return std::nullopt;
+        return it->second;
+    }
+
+    void Set(u8string_view hash, const RatingTuple& ratings)
+    {
+        if (!_loaded)
+        {
+            Load();
+        }
+
+        _ratings[u8string(hash)] = ratings;
+        _dirty = true;
+    }
+
+    void Flush()
+    {
+        if (!_dirty)
+            return;
+
+        json_t jsonRatings = json_t::object();
+        for (const auto& [hash, ratings] : _ratings)
+        {
+            jsonRatings[hash] = { ratings.Excitement, ratings.Intensity, ratings.Nausea };
+        }
+
+        json_t jsonCache = {
+            { "version", Version },
+            { "ratings", jsonRatings },
+        };
+
+        auto path = GetPath();
+        try
+        {
+            Path::CreateDirectory(Path::GetDirectory(path));
+            Json::WriteToFile(path, jsonCache, 0);
+            _dirty = false;
+        }
+        catch (const std::exception& e)
+        {
+            LOG_WARNING("Unable to write track design ratings %s: %s", path.c_str(), e.what());
+        }
+    }
+} // namespace TrackDesignRatingsCache
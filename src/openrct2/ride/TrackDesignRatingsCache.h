@@ -0,0 +1,28 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../core/String.hpp"
+#include "RideRatings.h"
+
+#include <optional>
+
+/**
+ * Caches the ratings estimated for track designs, keyed by the hash of the design file. The cache is read from disk
+ * on first use and only written when Flush is called, so rating a folder of designs writes the file once.
+ */
+namespace TrackDesignRatingsCache
+{
+    std::optional<RatingTuple> Get(u8string_view hash);
+    void Set(u8string_view hash, const RatingTuple& ratings);
+
+    // Writes the cache to disk if any ratings were added since it was read.
+    void Flush();
+} // namespace TrackDesignRatingsCache
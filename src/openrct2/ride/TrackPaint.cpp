@@ -29,6 +29,9 @@
 #include "TrackData.h"
 #include "TrackDesign.h"
 
+#include <array>
+#include <vector>
+
 using namespace OpenRCT2::TrackMetaData;
 
 /* rct2: 0x007667AC */
@@ -2168,6 +2171,37 @@ void TrackPaintUtilLeftCorkscrewUpSupports(PaintSession& session, Direction dire
     }
 }
 
+using TrackPaintFunctionTable = std::array<TRACK_PAINT_FUNCTION, TrackElemType::Count>;
+
+static std::vector<TrackPaintFunctionTable> CreateTrackPaintFunctionTables()
+{
+    std::vector<TrackPaintFunctionTable> tables(RIDE_TYPE_COUNT);
+    for (ride_type_t rideType = 0; rideType < RIDE_TYPE_COUNT; rideType++)
+    {
+        auto& table = tables[rideType];
+        const auto paintFunctionGetter = GetRideTypeDescriptor(rideType).TrackPaintFunction;
+        for (track_type_t trackType = 0; trackType < TrackElemType::Count; trackType++)
+        {
+            table[trackType] = paintFunctionGetter != nullptr ? paintFunctionGetter(trackType) : nullptr;
+        }
+    }
+    return tables;
+}
+
+/**
+ * The paint function getters of each ride type are large switch statements over every track type. They are resolved
+ * once for all ride and track types the first time a track is painted, after which painting a track piece is a lookup.
+ */
+TRACK_PAINT_FUNCTION GetTrackPaintFunctionForRideType(ride_type_t rideType, track_type_t trackType)
+{
+    static const auto tables = CreateTrackPaintFunctionTables();
+    if (rideType >= RIDE_TYPE_COUNT || trackType >= TrackElemType::Count)
+    {
+        return nullptr;
+    }
+    return tables[rideType][trackType];
+}
+
 /**
  *
  *  rct2: 0x006C4794
@@ -2246,15 +2280,10 @@ void PaintTrack(PaintSession& session, Direction direction, int32_t height, cons
             return;
         }
 
-        const auto& rtd = GetRideTypeDescriptor(trackElement.GetRideType());
-        TRACK_PAINT_FUNCTION_GETTER paintFunctionGetter = rtd.TrackPaintFunction;
-        if (paintFunctionGetter != nullptr)
+        TRACK_PAINT_FUNCTION paintFunction = GetTrackPaintFunctionForRideType(trackElement.GetRideType(), trackType);
+        if (paintFunction != nullptr)
         {
-            TRACK_PAINT_FUNCTION paintFunction = paintFunctionGetter(trackType);
-            if (paintFunction != nullptr)
-            {
-                paintFunction(session, *ride, trackSequence, direction, height, trackElement);
-            }
+            paintFunction(session, *ride, trackSequence, direction, height, trackElement);
         }
     }
 }
@@ -402,6 +402,8 @@ using TRACK_PAINT_FUNCTION = void (*)(
     const TrackElement& trackElement);
 using TRACK_PAINT_FUNCTION_GETTER = TRACK_PAINT_FUNCTION (*)(int32_t trackType);
 
+TRACK_PAINT_FUNCTION GetTrackPaintFunctionForRideType(ride_type_t rideType, track_type_t trackType);
+
 TRACK_PAINT_FUNCTION GetTrackPaintFunctionStandUpRC(int32_t trackType);
 TRACK_PAINT_FUNCTION GetTrackPaintFunctionSuspendedSwingingRC(int32_t trackType);
 TRACK_PAINT_FUNCTION GetTrackPaintFunctionInvertedRC(int32_t trackType);
@@ -17,10 +17,13 @@
 #    include "../world/Map.h"
 
 #    include <cstdio>
+#    include <cstring>
 #    include <dukglue/dukglue.h>
 #    include <duktape.h>
 #    include <optional>
 #    include <stdexcept>
+#    include <type_traits>
+#    include <vector>
 
 namespace OpenRCT2::Scripting
 {
@@ -342,6 +345,35 @@ namespace OpenRCT2::Scripting
         return range.Normalise();
     }
 
+    /**
+     * Copies the values into a new typed array of the matching element type.
+     */
+    template<typename T> DukValue ToDukTypedArray(duk_context* ctx, const std::vector<T>& values)
+    {
+        duk_uint_t type;
+        if constexpr (std::is_same_v<T, uint8_t>)
+            type = DUK_BUFOBJ_UINT8ARRAY;
+        else if constexpr (std::is_same_v<T, int16_t>)
+            type = DUK_BUFOBJ_INT16ARRAY;
+        else if constexpr (std::is_same_v<T, uint32_t>)
+            type = DUK_BUFOBJ_UINT32ARRAY;
+        else
+        {
+            static_assert(std::is_same_v<T, int32_t>, "Unsupported typed array element type");
+            type = DUK_BUFOBJ_INT32ARRAY;
+        }
+
+        const auto dataLen = values.size() * sizeof(T);
+        auto* data = duk_push_fixed_buffer(ctx, dataLen);
+        if (dataLen != 0)
+        {
+            std::memcpy(data, values.data(), dataLen);
+        }
+        duk_push_buffer_object(ctx, -1, 0, dataLen, type);
+        duk_remove(ctx, -2);
+        return DukValue::take_from_stack(ctx);
+    }
+
     template<> DukValue inline ToDuk(duk_context* ctx, const CoordsXY& coords)
     {
         DukObject dukCoords(ctx);
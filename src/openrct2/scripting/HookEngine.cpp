@@ -11,10 +11,13 @@
 
 #    include "HookEngine.h"
 
+#    include "../Game.h"
 #    include "../core/EnumMap.hpp"
 #    include "ScriptEngine.h"
 
+#    include <algorithm>
 #    include <unordered_map>
+#    include <utility>
 
 using namespace OpenRCT2::Scripting;
 
@@ -42,6 +45,22 @@ HOOK_TYPE OpenRCT2::Scripting::GetHookType(const std::string& name)
     return (result != HooksLookupTable.end()) ? result->second : HOOK_TYPE::UNDEFINED;
 }
 
+std::string_view OpenRCT2::Scripting::GetHookName(HOOK_TYPE type)
+{
+    return HooksLookupTable[type];
+}
+
+bool HookFilter::Matches(const HookActionInfo& action) const
+{
+    if (TopLevelOnly && !action.IsTopLevel)
+        return false;
+    if (ActionTypes.empty() && CustomActions.empty())
+        return true;
+    if (action.Type == GameCommand::Custom)
+        return std::find(CustomActions.begin(), CustomActions.end(), action.CustomId) != CustomActions.end();
+    return std::find(ActionTypes.begin(), ActionTypes.end(), action.Type) != ActionTypes.end();
+}
+
 HookEngine::HookEngine(ScriptEngine& scriptEngine)
     : _scriptEngine(scriptEngine)
 {
@@ -52,11 +71,11 @@ HookEngine::HookEngine(ScriptEngine& scriptEngine)
     }
 }
 
-uint32_t HookEngine::Subscribe(HOOK_TYPE type, std::shared_ptr<Plugin> owner, const DukValue& function)
+uint32_t HookEngine::Subscribe(HOOK_TYPE type, std::shared_ptr<Plugin> owner, const DukValue& function, HookFilter filter)
 {
     auto& hookList = GetHookList(type);
     auto cookie = _nextCookie++;
-    hookList.Hooks.emplace_back(cookie, owner, function);
+    hookList.Hooks.emplace_back(cookie, owner, function, std::move(filter));
     return cookie;
 }
 
@@ -99,6 +118,12 @@ bool HookEngine::HasSubscriptions(HOOK_TYPE type) const
     return !hookList.Hooks.empty();
 }
 
+bool HookEngine::HasSubscriptions(HOOK_TYPE type, const HookActionInfo& action) const
+{
+    const auto& hooks = GetHookList(type).Hooks;
+    return std::any_of(hooks.begin(), hooks.end(), [&action](const Hook& hook) { return hook.Filter.Matches(action); });
+}
+
 bool HookEngine::IsValidHookForPlugin(HOOK_TYPE type, Plugin& plugin) const
 {
     if (type == HOOK_TYPE::MAP_CHANGED && plugin.GetMetadata().Type != PluginType::Intransient)
@@ -113,6 +138,7 @@ void HookEngine::Call(HOOK_TYPE type, bool isGameStateMutable)
     auto& hookList = GetHookList(type);
     for (auto& hook : hookList.Hooks)
     {
+        PluginCallTimer timer(hook.Owner, GetHookName(type));
         _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, {}, isGameStateMutable);
     }
 }
@@ -122,6 +148,20 @@ void HookEngine::Call(HOOK_TYPE type, const DukValue& arg, bool isGameStateMutab
     auto& hookList = GetHookList(type);
     for (auto& hook : hookList.Hooks)
     {
+        PluginCallTimer timer(hook.Owner, GetHookName(type));
+        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, { arg }, isGameStateMutable);
+    }
+}
+
+void HookEngine::Call(HOOK_TYPE type, const HookActionInfo& action, const DukValue& arg, bool isGameStateMutable)
+{
+    auto& hookList = GetHookList(type);
+    for (auto& hook : hookList.Hooks)
+    {
+        if (!hook.Filter.Matches(action))
+            continue;
+
+        PluginCallTimer timer(hook.Owner, GetHookName(type));
         _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, { arg }, isGameStateMutable);
     }
 }
@@ -132,6 +172,7 @@ void HookEngine::Call(
     auto& hookList = GetHookList(type);
     for (auto& hook : hookList.Hooks)
     {
+        PluginCallTimer timer(hook.Owner, GetHookName(type));
         auto ctx = _scriptEngine.GetContext();
 
         // Convert key/value pairs into an object
@@ -17,9 +17,12 @@
 #    include <any>
 #    include <memory>
 #    include <string>
+#    include <string_view>
 #    include <tuple>
 #    include <vector>
 
+enum class GameCommand : int32_t;
+
 namespace OpenRCT2::Scripting
 {
     class ScriptEngine;
@@ -48,18 +51,43 @@ namespace OpenRCT2::Scripting
     };
     constexpr size_t NUM_HOOK_TYPES = static_cast<size_t>(HOOK_TYPE::COUNT);
     HOOK_TYPE GetHookType(const std::string& name);
+    std::string_view GetHookName(HOOK_TYPE type);
+
+    struct HookActionInfo
+    {
+        GameCommand Type{};
+        // The identifier of a custom action, empty for other actions.
+        std::string_view CustomId;
+        bool IsTopLevel{};
+    };
+
+    /**
+     * Limits the game actions an action.query or action.execute hook is called for, so that no arguments
+     * have to be created for actions the plug-in is not interested in.
+     */
+    struct HookFilter
+    {
+        // Both are empty if the hook is called for every action.
+        std::vector<GameCommand> ActionTypes;
+        std::vector<std::string> CustomActions;
+        bool TopLevelOnly{};
+
+        bool Matches(const HookActionInfo& action) const;
+    };
 
     struct Hook
     {
         uint32_t Cookie;
         std::shared_ptr<Plugin> Owner;
         DukValue Function;
+        HookFilter Filter;
 
         Hook() = default;
-        Hook(uint32_t cookie, std::shared_ptr<Plugin> owner, const DukValue& function)
+        Hook(uint32_t cookie, std::shared_ptr<Plugin> owner, const DukValue& function, HookFilter filter)
             : Cookie(cookie)
             , Owner(owner)
             , Function(function)
+            , Filter(std::move(filter))
         {
         }
     };
@@ -84,14 +112,17 @@ namespace OpenRCT2::Scripting
     public:
         HookEngine(ScriptEngine& scriptEngine);
         HookEngine(const HookEngine&) = delete;
-        uint32_t Subscribe(HOOK_TYPE type, std::shared_ptr<Plugin> owner, const DukValue& function);
+        uint32_t Subscribe(
+            HOOK_TYPE type, std::shared_ptr<Plugin> owner, const DukValue& function, HookFilter filter = {});
         void Unsubscribe(HOOK_TYPE type, uint32_t cookie);
         void UnsubscribeAll(std::shared_ptr<const Plugin> owner);
         void UnsubscribeAll();
         bool HasSubscriptions(HOOK_TYPE type) const;
+        bool HasSubscriptions(HOOK_TYPE type, const HookActionInfo& action) const;
         bool IsValidHookForPlugin(HOOK_TYPE type, Plugin& plugin) const;
         void Call(HOOK_TYPE type, bool isGameStateMutable);
         void Call(HOOK_TYPE type, const DukValue& arg, bool isGameStateMutable);
+        void Call(HOOK_TYPE type, const HookActionInfo& action, const DukValue& arg, bool isGameStateMutable);
         void Call(
             HOOK_TYPE type, const std::initializer_list<std::pair<std::string_view, std::any>>& args, bool isGameStateMutable);
 
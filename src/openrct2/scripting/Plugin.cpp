@@ -11,18 +11,248 @@
 
 #    include "Plugin.h"
 
+#    include "../Context.h"
 #    include "../Diagnostic.h"
 #    include "../OpenRCT2.h"
+#    include "../PlatformEnvironment.h"
+#    include "../Version.h"
+#    include "../core/Crypt.h"
 #    include "../core/File.h"
+#    include "../core/FileScanner.h"
+#    include "../core/Path.hpp"
+#    include "../core/String.hpp"
 #    include "Duktape.hpp"
 #    include "ScriptEngine.h"
 
 #    include <algorithm>
+#    include <chrono>
+#    include <cstring>
 #    include <fstream>
 #    include <memory>
+#    include <utility>
 
+using namespace OpenRCT2;
 using namespace OpenRCT2::Scripting;
 
+using Milliseconds = std::chrono::duration<double, std::milli>;
+
+namespace
+{
+    constexpr uint32_t BytecodeMagic = 0x43425052; // RPBC
+    constexpr uint32_t BytecodeVersion = 1;
+
+    // Each entry is this header followed by the bytecode. Duktape does not validate bytecode, so the header is checked
+    // before the bytecode is loaded.
+    struct BytecodeHeader
+    {
+        uint32_t Magic;
+        uint32_t Version;
+        Crypt::FNV1aAlgorithm::Result BuildId;
+        uint64_t Length;
+        Crypt::FNV1aAlgorithm::Result Checksum;
+    };
+
+    // Scripts sent by servers have no file to key their entries by, so the oldest are removed past this size instead
+    constexpr uint64_t MaxNetworkBytecodeCacheSize = 16 * 1024 * 1024;
+} // namespace
+
+/**
+ * The bytecode format is specific to the Duktape version and to how the game was built, so bytecode is only used by
+ * the build that wrote it.
+ */
+static const Crypt::FNV1aAlgorithm::Result& GetBytecodeBuildId()
+{
+    static const auto buildId = []() {
+        auto build = String::StdFormat(
+            "%s %s %s %ld %zu", gVersionInfoFull, OPENRCT2_PLATFORM, OPENRCT2_ARCHITECTURE,
+            static_cast<long>(DUK_VERSION), sizeof(void*));
+        return Crypt::FNV1a(build.data(), build.size());
+    }();
+    return buildId;
+}
+
+static u8string ToHex(const uint8_t* data, size_t length)
+{
+    u8string result;
+    char hex[3];
+    for (size_t i = 0; i < length; i++)
+    {
+        snprintf(hex, sizeof(hex), "%02x", data[i]);
+        result += hex;
+    }
+    return result;
+}
+
+static u8string GetBytecodeCacheDirectory(bool isNetwork)
+{
+    auto env = GetContext()->GetPlatformEnvironment();
+    return Path::Combine(
+        env->GetDirectoryPath(DIRBASE::CACHE), isNetwork ? u8"plugin_bytecode_network" : u8"plugin_bytecode");
+}
+
+// Entries of the same plug-in file start with the same prefix, so that the previous entry can be removed.
+static u8string GetBytecodeCachePrefix(std::string_view pluginPath)
+{
+    auto hash = Crypt::FNV1a(pluginPath.data(), pluginPath.size());
+    return ToHex(hash.data(), hash.size()) + u8"_";
+}
+
+/**
+ * Compiled code is cached by a hash of the wrapped code and the build, so that plug-ins are only compiled again when
+ * they change. Plug-ins without a file, such as those sent by a server, are only keyed by that hash.
+ */
+static u8string GetBytecodeCachePath(std::string_view pluginPath, const std::string& code)
+{
+    const auto& buildId = GetBytecodeBuildId();
+    auto hash = Crypt::CreateSHA1()->Update(buildId.data(), buildId.size())->Update(code.data(), code.size())->Finish();
+    auto prefix = pluginPath.empty() ? u8string() : GetBytecodeCachePrefix(pluginPath);
+    return Path::Combine(
+        GetBytecodeCacheDirectory(pluginPath.empty()), prefix + ToHex(hash.data(), hash.size()) + u8".bin");
+}
+
+// Removes the previous entries of the plug-in file, so reloading a plug-in that is being worked on does not fill the cache.
+static void RemoveStaleBytecode(std::string_view pluginPath, const u8string& path)
+{
+    auto pattern = Path::Combine(GetBytecodeCacheDirectory(false), GetBytecodeCachePrefix(pluginPath) + u8"*.bin");
+    auto scanner = Path::ScanDirectory(pattern, false);
+    while (scanner->Next())
+    {
+        if (scanner->GetPath() != path)
+        {
+            File::Delete(scanner->GetPath());
+        }
+    }
+}
+
+// Removes the oldest entries of scripts sent by servers until the cache is within its size limit.
+static void TrimNetworkBytecode(const u8string& path)
+{
+    struct Entry
+    {
+        u8string Path;
+        uint64_t Size;
+        uint64_t LastModified;
+    };
+    std::vector<Entry> entries;
+    uint64_t totalSize = 0;
+
+    auto pattern = Path::Combine(GetBytecodeCacheDirectory(true), u8"*.bin");
+    auto scanner = Path::ScanDirectory(pattern, false);
+    while (scanner->Next())
+    {
+        const auto& info = scanner->GetFileInfo();
+        entries.push_back({ scanner->GetPath(), info.Size, info.LastModified });
+        totalSize += info.Size;
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.LastModified < b.LastModified; });
+    for (const auto& entry : entries)
+    {
+        if (totalSize <= MaxNetworkBytecodeCacheSize)
+            break;
+        if (entry.Path != path)
+        {
+            File::Delete(entry.Path);
+            totalSize -= entry.Size;
+        }
+    }
+}
+
+static duk_ret_t LoadFunctionSafe(duk_context* ctx, void*)
+{
+    duk_load_function(ctx);
+    return 1;
+}
+
+/**
+ * Pushes the function loaded from the bytecode cache, returns false and pushes nothing if there is no valid entry.
+ * The cache only ever holds bytecode compiled by this machine, bytecode received from elsewhere is never loaded.
+ */
+static bool LoadCachedBytecode(duk_context* ctx, const u8string& path)
+{
+    if (!File::Exists(path))
+        return false;
+
+    std::vector<uint8_t> data;
+    try
+    {
+        data = File::ReadAllBytes(path);
+    }
+    catch (const std::exception& e)
+    {
+        LOG_WARNING("Unable to read plug-in bytecode %s: %s", path.c_str(), e.what());
+        return false;
+    }
+
+    // Entries that are truncated, corrupt or from another build are compiled again and replaced
+    BytecodeHeader header{};
+    if (data.size() < sizeof(header))
+        return false;
+    std::memcpy(&header, data.data(), sizeof(header));
+    const auto* bytecode = data.data() + sizeof(header);
+    const auto length = data.size() - sizeof(header);
+    if (header.Magic != BytecodeMagic || header.Version != BytecodeVersion || header.BuildId != GetBytecodeBuildId()
+        || header.Length != length || header.Checksum != Crypt::FNV1a(bytecode, length))
+    {
+        LOG_VERBOSE("Ignoring invalid plug-in bytecode %s", path.c_str());
+        return false;
+    }
+
+    auto* buffer = duk_push_fixed_buffer(ctx, length);
+    std::memcpy(buffer, bytecode, length);
+    if (duk_safe_call(ctx, LoadFunctionSafe, nullptr, 1, 1) != DUK_EXEC_SUCCESS)
+    {
+        LOG_WARNING("Invalid plug-in bytecode %s: %s", path.c_str(), duk_safe_to_string(ctx, -1));
+        duk_pop(ctx);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Writes the compiled function on top of the stack to the bytecode cache, the stack is left unchanged. Previous entries
+ * of the plug-in are removed, or the oldest entries for plug-ins without a file, so the cache does not keep growing.
+ */
+static void SaveCachedBytecode(duk_context* ctx, std::string_view pluginPath, const u8string& path)
+{
+    duk_dup(ctx, -1);
+    duk_dump_function(ctx);
+
+    duk_size_t size{};
+    const auto* bytecode = static_cast<const uint8_t*>(duk_get_buffer_data(ctx, -1, &size));
+    try
+    {
+        Path::CreateDirectory(GetBytecodeCacheDirectory(pluginPath.empty()));
+        if (!pluginPath.empty())
+        {
+            RemoveStaleBytecode(pluginPath, path);
+        }
+
+        BytecodeHeader header{
+            BytecodeMagic, BytecodeVersion, GetBytecodeBuildId(), size, Crypt::FNV1a(bytecode, size),
+        };
+        std::vector<uint8_t> data(sizeof(header) + size);
+        std::memcpy(data.data(), &header, sizeof(header));
+        std::memcpy(data.data() + sizeof(header), bytecode, size);
+
+        // Write to a temporary file first so another instance of the game never reads an incomplete entry
+        auto tempPath = path + u8".tmp";
+        File::WriteAllBytes(tempPath, data.data(), data.size());
+        File::Delete(path);
+        File::Move(tempPath, path);
+
+        if (pluginPath.empty())
+        {
+            TrimNetworkBytecode(path);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        LOG_WARNING("Unable to write plug-in bytecode %s: %s", path.c_str(), e.what());
+    }
+    duk_pop(ctx);
+}
+
 Plugin::Plugin(duk_context* context, std::string_view path)
     : _context(context)
     , _path(path)
@@ -63,8 +293,21 @@ void Plugin::Load()
         "     })(" + projectedVariables + ");";
     // clang-format on
 
-    auto flags = DUK_COMPILE_EVAL | DUK_COMPILE_SAFE | DUK_COMPILE_NOSOURCE | DUK_COMPILE_NOFILENAME;
-    auto result = duk_eval_raw(_context, code.c_str(), code.size(), flags);
+    auto compileStart = std::chrono::high_resolution_clock::now();
+    if (!CompileCode(code))
+    {
+        auto val = std::string(duk_safe_to_string(_context, -1));
+        duk_pop(_context);
+        throw std::runtime_error("Failed to load plug-in script: " + val);
+    }
+
+    // Same as duk_eval_raw, which this replaces so that the compiled code can be cached
+    auto runStart = std::chrono::high_resolution_clock::now();
+    duk_push_global_object(_context);
+    auto result = duk_pcall_method(_context, 0);
+    auto runEnd = std::chrono::high_resolution_clock::now();
+    _loadTimings.CompileMs = Milliseconds(runStart - compileStart).count();
+    _loadTimings.RunMs = Milliseconds(runEnd - runStart).count();
     if (result != DUK_ERR_NONE)
     {
         auto val = std::string(duk_safe_to_string(_context, -1));
@@ -76,6 +319,24 @@ void Plugin::Load()
     _hasLoaded = true;
 }
 
+/**
+ * Pushes the compiled code, or the error if it could not be compiled.
+ */
+bool Plugin::CompileCode(const std::string& code)
+{
+    auto cachePath = GetBytecodeCachePath(_path, code);
+    _loadTimings.FromCache = LoadCachedBytecode(_context, cachePath);
+    if (_loadTimings.FromCache)
+        return true;
+
+    auto flags = DUK_COMPILE_EVAL | DUK_COMPILE_SAFE | DUK_COMPILE_NOSOURCE | DUK_COMPILE_NOFILENAME;
+    if (duk_compile_raw(_context, code.c_str(), code.size(), flags) != DUK_EXEC_SUCCESS)
+        return false;
+
+    SaveCachedBytecode(_context, _path, cachePath);
+    return true;
+}
+
 void Plugin::Start()
 {
     if (!_hasLoaded)
@@ -220,9 +481,60 @@ int32_t Plugin::GetTargetAPIVersion() const
     return 33;
 }
 
+void Plugin::RecordCall(std::string_view name, double ms)
+{
+    auto it = std::find_if(
+        _callTimings.begin(), _callTimings.end(), [name](const PluginCallTimings& timings) { return timings.Name == name; });
+    if (it == _callTimings.end())
+    {
+        it = _callTimings.insert(_callTimings.end(), PluginCallTimings{ name });
+    }
+    it->CallCount++;
+    it->TotalMs += ms;
+    it->MaxMs = std::max(it->MaxMs, ms);
+    _budget.Ms += ms;
+}
+
+void Plugin::ResetCallTimings()
+{
+    _callTimings.clear();
+}
+
 bool Plugin::IsTransient() const
 {
     return _metadata.Type != PluginType::Intransient;
 }
 
+// Innermost timer that is running, plug-ins are only called from the main thread.
+static PluginCallTimer* _currentCallTimer;
+
+PluginCallTimer::PluginCallTimer(std::shared_ptr<Plugin> plugin, std::string_view name)
+    : _plugin(std::move(plugin))
+    , _name(name)
+    , _start(std::chrono::high_resolution_clock::now())
+    , _parent(_currentCallTimer)
+{
+    if (_parent != nullptr)
+    {
+        _parent->_elapsedMs += Milliseconds(_start - _parent->_start).count();
+    }
+    _currentCallTimer = this;
+}
+
+PluginCallTimer::~PluginCallTimer()
+{
+    const auto end = std::chrono::high_resolution_clock::now();
+    if (_plugin != nullptr)
+    {
+        _plugin->RecordCall(_name, _elapsedMs + Milliseconds(end - _start).count());
+    }
+
+    // Resume the outer timer
+    _currentCallTimer = _parent;
+    if (_parent != nullptr)
+    {
+        _parent->_start = end;
+    }
+}
+
 #endif
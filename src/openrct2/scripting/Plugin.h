@@ -13,6 +13,7 @@
 
 #    include "Duktape.hpp"
 
+#    include <chrono>
 #    include <memory>
 #    include <string>
 #    include <string_view>
@@ -52,12 +53,45 @@ namespace OpenRCT2::Scripting
         DukValue Main;
     };
 
+    struct PluginLoadTimings
+    {
+        // Time taken to compile the code, or to load the compiled code from the bytecode cache.
+        double CompileMs{};
+        // Time taken to run the top level code of the script, which registers the plug-in.
+        double RunMs{};
+        bool FromCache{};
+    };
+
+    struct PluginCallTimings
+    {
+        // The hook, or interval or custom action, the time was spent in. Time spent in calls made from it to other
+        // hooks or custom actions is not included.
+        std::string_view Name;
+        uint32_t CallCount{};
+        double TotalMs{};
+        double MaxMs{};
+    };
+
+    struct PluginBudget
+    {
+        // Time spent in calls since the budget was last checked.
+        double Ms{};
+        // Number of consecutive checks the hard budget was exceeded in.
+        uint32_t NumOverHardBudget{};
+        // Check in which the last warning was written, so a slow plug-in does not flood the console.
+        uint32_t LastWarning{};
+        bool HasWarned{};
+    };
+
     class Plugin
     {
     private:
         duk_context* _context{};
         std::string _path;
         PluginMetadata _metadata{};
+        PluginLoadTimings _loadTimings{};
+        std::vector<PluginCallTimings> _callTimings;
+        PluginBudget _budget{};
         std::string _code;
         bool _hasLoaded{};
         bool _hasStarted{};
@@ -79,6 +113,16 @@ namespace OpenRCT2::Scripting
             return _metadata;
         }
 
+        const PluginLoadTimings& GetLoadTimings() const
+        {
+            return _loadTimings;
+        }
+
+        const std::vector<PluginCallTimings>& GetCallTimings() const
+        {
+            return _callTimings;
+        }
+
         const std::string& GetCode() const
         {
             return _code;
@@ -117,13 +161,43 @@ namespace OpenRCT2::Scripting
 
         bool IsTransient() const;
 
+        void RecordCall(std::string_view name, double ms);
+        void ResetCallTimings();
+
+        PluginBudget& GetBudget()
+        {
+            return _budget;
+        }
+
     private:
         void LoadCodeFromFile();
+        bool CompileCode(const std::string& code);
 
         static PluginMetadata GetMetadata(const DukValue& dukMetadata);
         static PluginType ParsePluginType(std::string_view type);
         static void CheckForLicence(const DukValue& dukLicence, std::string_view pluginName);
     };
+
+    /**
+     * Adds the time between construction and destruction to the call timings of a plug-in. Timers can be nested, e.g.
+     * when a hook runs a custom action of another plug-in, the outer timer is paused while the inner one runs so the
+     * time is only given to one plug-in.
+     */
+    class PluginCallTimer
+    {
+    private:
+        std::shared_ptr<Plugin> _plugin;
+        std::string_view _name;
+        std::chrono::high_resolution_clock::time_point _start;
+        // Time spent in this call before it was paused by the inner timers.
+        double _elapsedMs{};
+        PluginCallTimer* _parent{};
+
+    public:
+        PluginCallTimer(std::shared_ptr<Plugin> plugin, std::string_view name);
+        PluginCallTimer(const PluginCallTimer&) = delete;
+        ~PluginCallTimer();
+    };
 } // namespace OpenRCT2::Scripting
 
 #endif
@@ -11,6 +11,8 @@
 
 #    include "ScriptEngine.h"
 
+#    include "../Game.h"
+#    include "../OpenRCT2.h"
 #    include "../PlatformEnvironment.h"
 #    include "../actions/CustomAction.h"
 #    include "../actions/GameAction.h"
@@ -21,8 +23,10 @@
 #    include "../core/File.h"
 #    include "../core/FileScanner.h"
 #    include "../core/Path.hpp"
+#    include "../core/String.hpp"
 #    include "../interface/InteractiveConsole.h"
 #    include "../platform/Platform.h"
+#    include "../profiling/Profiling.h"
 #    include "Duktape.hpp"
 #    include "bindings/entity/ScEntity.hpp"
 #    include "bindings/entity/ScGuest.hpp"
@@ -54,10 +58,12 @@
 #    include "bindings/world/ScTile.hpp"
 #    include "bindings/world/ScTileElement.hpp"
 
+#    include <cstdlib>
 #    include <iostream>
 #    include <memory>
 #    include <stdexcept>
 #    include <string>
+#    include <utility>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Scripting;
@@ -368,9 +374,65 @@ public:
     }
 };
 
+// Prefixes each duktape allocation so its size is known when it is freed, the flag keeps
+// the accounting balanced when memory tracking is toggled while the allocation is alive.
+struct alignas(std::max_align_t) DukAllocationHeader
+{
+    size_t Size;
+    bool Tracked;
+};
+
+static void* DukAllocationInit(DukAllocationHeader* header, size_t size)
+{
+    header->Size = size;
+    header->Tracked = Profiling::TrackAllocation(Profiling::MemoryTag::Scripting, size);
+    return header + 1;
+}
+
+static void DukAllocationRelease(const DukAllocationHeader& header)
+{
+    if (header.Tracked)
+    {
+        Profiling::TrackDeallocation(Profiling::MemoryTag::Scripting, header.Size);
+    }
+}
+
+static void* DukAlloc(void* /*udata*/, duk_size_t size)
+{
+    auto* header = static_cast<DukAllocationHeader*>(std::malloc(sizeof(DukAllocationHeader) + size));
+    if (header == nullptr)
+        return nullptr;
+    return DukAllocationInit(header, size);
+}
+
+static void DukFree(void* /*udata*/, void* ptr)
+{
+    if (ptr == nullptr)
+        return;
+
+    auto* header = static_cast<DukAllocationHeader*>(ptr) - 1;
+    DukAllocationRelease(*header);
+    std::free(header);
+}
+
+static void* DukRealloc(void* udata, void* ptr, duk_size_t size)
+{
+    if (ptr == nullptr)
+        return DukAlloc(udata, size);
+
+    auto* header = static_cast<DukAllocationHeader*>(ptr) - 1;
+    const auto oldHeader = *header;
+    auto* newHeader = static_cast<DukAllocationHeader*>(std::realloc(header, sizeof(DukAllocationHeader) + size));
+    if (newHeader == nullptr)
+        return nullptr;
+
+    DukAllocationRelease(oldHeader);
+    return DukAllocationInit(newHeader, size);
+}
+
 DukContext::DukContext()
 {
-    _context = duk_create_heap_default();
+    _context = duk_create_heap(DukAlloc, DukRealloc, DukFree, nullptr, nullptr);
     if (_context == nullptr)
     {
         throw std::runtime_error("Unable to initialise duktape context.");
@@ -623,6 +685,14 @@ void ScriptEngine::UnregisterPlugin(std::string_view path)
     }
 }
 
+static std::string GetLoadedMessage(std::string_view message, const Plugin& plugin)
+{
+    const auto& timings = plugin.GetLoadTimings();
+    return String::StdFormat(
+        "%s (%s in %.2f ms, ran in %.2f ms)", std::string(message).c_str(), timings.FromCache ? "cached" : "compiled",
+        timings.CompileMs, timings.RunMs);
+}
+
 void ScriptEngine::RegisterPlugin(std::string_view path)
 {
     try
@@ -636,7 +706,7 @@ void ScriptEngine::RegisterPlugin(std::string_view path)
         // Unload the plugin now, metadata is kept
         plugin->Unload();
 
-        LogPluginInfo(plugin, "Registered");
+        LogPluginInfo(plugin, GetLoadedMessage("Registered", *plugin));
         _plugins.push_back(std::move(plugin));
     }
     catch (const std::exception& e)
@@ -706,7 +776,7 @@ void ScriptEngine::LoadPlugin(std::shared_ptr<Plugin>& plugin)
             {
                 ScriptExecutionInfo::PluginScope scope(_execInfo, plugin, false);
                 plugin->Load();
-                LogPluginInfo(plugin, "Loaded");
+                LogPluginInfo(plugin, GetLoadedMessage("Loaded", *plugin));
             }
             else
             {
@@ -772,7 +842,7 @@ void ScriptEngine::ReloadPlugin(std::shared_ptr<Plugin> plugin)
     {
         ScriptExecutionInfo::PluginScope scope(_execInfo, plugin, false);
         plugin->Load();
-        LogPluginInfo(plugin, "Reloaded");
+        LogPluginInfo(plugin, GetLoadedMessage("Reloaded", *plugin));
     }
     StartPlugin(plugin);
 }
@@ -912,6 +982,74 @@ void ScriptEngine::Tick()
     UpdateSockets();
     ProcessREPL();
     DoAutoReloadPluginCheck();
+    CheckPluginBudgets();
+}
+
+// Number of consecutive ticks a plug-in can exceed the hard budget for before it is suspended, so that a single slow
+// tick, e.g. from garbage collection, does not stop a plug-in.
+static constexpr uint32_t HardBudgetTicks = 3;
+// Minimum number of ticks between two budget warnings for the same plug-in.
+static constexpr uint32_t BudgetWarningInterval = 400;
+
+void ScriptEngine::CheckPluginBudgets()
+{
+    const auto softBudgetMs = gConfigPlugin.SoftTimeBudget;
+    const auto hardBudgetMs = gConfigPlugin.HardTimeBudget;
+    _numBudgetChecks++;
+
+    // Several game ticks are run per check when the game is fast forwarded, the budgets are per game tick
+    uint32_t numTicks = 1;
+    if (gCurrentTicks > _lastBudgetCheckTick)
+    {
+        numTicks = gCurrentTicks - _lastBudgetCheckTick;
+    }
+    _lastBudgetCheckTick = gCurrentTicks;
+
+    // Copied as stopping a plug-in can run its callbacks
+    auto plugins = _plugins;
+    for (const auto& plugin : plugins)
+    {
+        auto& budget = plugin->GetBudget();
+        const auto ms = std::exchange(budget.Ms, 0.0) / numTicks;
+        if (!plugin->HasStarted())
+            continue;
+
+        if (hardBudgetMs > 0)
+        {
+            budget.NumOverHardBudget = ms > hardBudgetMs ? budget.NumOverHardBudget + 1 : 0;
+            if (budget.NumOverHardBudget >= HardBudgetTicks && gOpenRCT2Headless)
+            {
+                LogPluginInfo(
+                    plugin,
+                    String::StdFormat(
+                        "Suspended for exceeding the hard time budget of %d ms for %u ticks, took %.2f ms per tick",
+                        hardBudgetMs, budget.NumOverHardBudget, ms));
+                budget.NumOverHardBudget = 0;
+                StopPlugin(plugin);
+                continue;
+            }
+        }
+
+        // Plug-ins are only suspended when running headless, otherwise the hard budget is used to warn if there is no soft
+        // budget
+        auto warnBudgetMs = softBudgetMs > 0 ? softBudgetMs : hardBudgetMs;
+        if (warnBudgetMs > 0 && ms > warnBudgetMs
+            && (!budget.HasWarned || _numBudgetChecks - budget.LastWarning >= BudgetWarningInterval))
+        {
+            LogPluginInfo(
+                plugin, String::StdFormat("Took %.2f ms per tick, the time budget is %d ms", ms, warnBudgetMs));
+            budget.LastWarning = _numBudgetChecks;
+            budget.HasWarned = true;
+        }
+    }
+}
+
+void ScriptEngine::ResetPluginCallTimings()
+{
+    for (const auto& plugin : _plugins)
+    {
+        plugin->ResetCallTimings();
+    }
 }
 
 void ScriptEngine::CheckAndStartPlugins()
@@ -1087,6 +1225,7 @@ GameActions::Result ScriptEngine::QueryOrExecuteCustomGameAction(const CustomAct
         }
 
         // Ready to call plugin handler
+        PluginCallTimer timer(customActionInfo.Owner, isExecute ? "action.custom.execute" : "action.custom.query");
         DukValue dukResult;
         if (!isExecute)
         {
@@ -1407,6 +1546,16 @@ static std::string GetActionName(GameCommand commandId)
     return {};
 }
 
+std::optional<GameCommand> OpenRCT2::Scripting::GetGameActionType(std::string_view name)
+{
+    auto it = ActionNameToType.find(name);
+    if (it != ActionNameToType.end())
+    {
+        return it->second;
+    }
+    return std::nullopt;
+}
+
 static std::unique_ptr<GameAction> CreateGameActionFromActionId(const std::string& name)
 {
     auto result = ActionNameToType.find(name);
@@ -1417,20 +1566,29 @@ static std::unique_ptr<GameAction> CreateGameActionFromActionId(const std::strin
     return nullptr;
 }
 
-void ScriptEngine::RunGameActionHooks(const GameAction& action, GameActions::Result& result, bool isExecute)
+void ScriptEngine::RunGameActionHooks(const GameAction& action, GameActions::Result& result, bool isExecute, bool isTopLevel)
 {
-    DukStackFrame frame(_context);
-
     auto hookType = isExecute ? HOOK_TYPE::ACTION_EXECUTE : HOOK_TYPE::ACTION_QUERY;
-    if (_hookEngine.HasSubscriptions(hookType))
+    if (!_hookEngine.HasSubscriptions(hookType))
+        return;
+
+    // Check the filters first so the arguments are only created when at least one hook is called
+    auto actionId = action.GetType();
+    std::string customId;
+    if (actionId == GameCommand::Custom)
     {
+        customId = static_cast<const CustomAction&>(action).GetId();
+    }
+    HookActionInfo actionInfo{ actionId, customId, isTopLevel };
+    if (_hookEngine.HasSubscriptions(hookType, actionInfo))
+    {
+        DukStackFrame frame(_context);
         DukObject obj(_context);
 
-        auto actionId = action.GetType();
-        if (action.GetType() == GameCommand::Custom)
+        if (actionId == GameCommand::Custom)
         {
-            auto customAction = static_cast<const CustomAction&>(action);
-            obj.Set("action", customAction.GetId());
+            auto& customAction = static_cast<const CustomAction&>(action);
+            obj.Set("action", customId);
 
             auto dukArgs = DuktapeTryParseJson(_context, customAction.GetJson());
             if (dukArgs)
@@ -1467,7 +1625,7 @@ void ScriptEngine::RunGameActionHooks(const GameAction& action, GameActions::Res
         obj.Set("result", GameActionResultToDuk(action, result));
         auto dukEventArgs = obj.Take();
 
-        _hookEngine.Call(hookType, dukEventArgs, false);
+        _hookEngine.Call(hookType, actionInfo, dukEventArgs, false);
 
         if (!isExecute)
         {
@@ -1660,7 +1818,10 @@ void ScriptEngine::UpdateIntervals()
         {
             if (timestamp >= interval.LastTimestamp + interval.Delay)
             {
-                ExecutePluginCall(interval.Owner, interval.Callback, {}, false);
+                {
+                    PluginCallTimer timer(interval.Owner, "interval");
+                    ExecutePluginCall(interval.Owner, interval.Callback, {}, false);
+                }
 
                 interval.LastTimestamp = timestamp;
                 if (!interval.Repeat)
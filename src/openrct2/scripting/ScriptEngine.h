@@ -23,6 +23,7 @@
 #    include <list>
 #    include <memory>
 #    include <mutex>
+#    include <optional>
 #    include <queue>
 #    include <string>
 #    include <unordered_map>
@@ -47,7 +48,7 @@ namespace OpenRCT2
 
 namespace OpenRCT2::Scripting
 {
-    static constexpr int32_t OPENRCT2_PLUGIN_API_VERSION = 78;
+    static constexpr int32_t OPENRCT2_PLUGIN_API_VERSION = 85;
 
     // Versions marking breaking changes.
     static constexpr int32_t API_VERSION_33_PEEP_DEPRECATION = 33;
@@ -156,6 +157,8 @@ namespace OpenRCT2::Scripting
         std::queue<std::tuple<std::promise<void>, std::string>> _evalQueue;
         std::vector<std::shared_ptr<Plugin>> _plugins;
         uint32_t _lastHotReloadCheckTick{};
+        uint32_t _numBudgetChecks{};
+        uint32_t _lastBudgetCheckTick{};
         HookEngine _hookEngine;
         ScriptExecutionInfo _execInfo;
         DukValue _sharedStorage;
@@ -234,6 +237,7 @@ namespace OpenRCT2::Scripting
         void UnloadTransientPlugins();
         void StopUnloadRegisterAllPlugins();
         void Tick();
+        void ResetPluginCallTimings();
         std::future<void> Eval(const std::string& s);
         DukValue ExecutePluginCall(
             const std::shared_ptr<Plugin>& plugin, const DukValue& func, const std::vector<DukValue>& args,
@@ -256,7 +260,7 @@ namespace OpenRCT2::Scripting
         [[nodiscard]] GameActions::Result QueryOrExecuteCustomGameAction(const CustomAction& action, bool isExecute);
         bool RegisterCustomAction(
             const std::shared_ptr<Plugin>& plugin, std::string_view action, const DukValue& query, const DukValue& execute);
-        void RunGameActionHooks(const GameAction& action, GameActions::Result& result, bool isExecute);
+        void RunGameActionHooks(const GameAction& action, GameActions::Result& result, bool isExecute, bool isTopLevel);
         [[nodiscard]] std::unique_ptr<GameAction> CreateGameAction(
             const std::string& actionid, const DukValue& args, const std::string& pluginName);
         [[nodiscard]] DukValue GameActionResultToDuk(const GameAction& action, const GameActions::Result& result);
@@ -291,6 +295,7 @@ namespace OpenRCT2::Scripting
         void DoAutoReloadPluginCheck();
         void AutoReloadPlugins();
         void ProcessREPL();
+        void CheckPluginBudgets();
         void RemoveCustomGameActions(const std::shared_ptr<Plugin>& plugin);
         [[nodiscard]] GameActions::Result DukToGameActionResult(const DukValue& d);
         static std::string_view ExpenditureTypeToString(ExpenditureType expenditureType);
@@ -310,6 +315,7 @@ namespace OpenRCT2::Scripting
     bool IsGameStateMutable();
     void ThrowIfGameStateNotMutable();
     int32_t GetTargetAPIVersion();
+    std::optional<GameCommand> GetGameActionType(std::string_view name);
 
     std::string Stringify(const DukValue& value);
 
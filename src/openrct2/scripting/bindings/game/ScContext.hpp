@@ -13,6 +13,7 @@
 
 #    include "../../../OpenRCT2.h"
 #    include "../../../actions/GameAction.h"
+#    include "../../../interface/CaptureQueue.h"
 #    include "../../../interface/Screenshot.h"
 #    include "../../../localisation/Formatting.h"
 #    include "../../../object/ObjectManager.h"
@@ -28,6 +29,7 @@
 
 #    include <cstdio>
 #    include <memory>
+#    include <utility>
 
 namespace OpenRCT2::Scripting
 {
@@ -126,7 +128,7 @@ namespace OpenRCT2::Scripting
             return "normal";
         }
 
-        void captureImage(const DukValue& options)
+        bool captureImage(const DukValue& options)
         {
             auto ctx = GetContext()->GetScriptEngine().GetContext();
             try
@@ -136,6 +138,15 @@ namespace OpenRCT2::Scripting
                 captureOptions.Rotation = options["rotation"].as_int() & 3;
                 captureOptions.Zoom = ZoomLevel(options["zoom"].as_int());
                 captureOptions.Transparent = AsOrDefault(options["transparent"], false);
+                captureOptions.Async = AsOrDefault(options["async"], false);
+
+                auto format = AsOrDefault(options["format"], "png");
+                if (format == "raw")
+                    captureOptions.Format = CaptureFormat::Raw;
+                else if (format == "png")
+                    captureOptions.Format = CaptureFormat::Png;
+                else
+                    throw DukException();
 
                 auto dukPosition = options["position"];
                 if (dukPosition.type() == DukValue::Type::OBJECT)
@@ -148,7 +159,7 @@ namespace OpenRCT2::Scripting
                     captureOptions.View = view;
                 }
 
-                CaptureImage(captureOptions);
+                return CaptureImage(captureOptions);
             }
             catch (const DukException&)
             {
@@ -158,6 +169,34 @@ namespace OpenRCT2::Scripting
             {
                 duk_error(ctx, DUK_ERR_ERROR, ex.what());
             }
+            return false;
+        }
+
+        DukValue getCaptureStatistics() const
+        {
+            auto ctx = GetContext()->GetScriptEngine().GetContext();
+            auto stats = CaptureQueue::GetStatistics();
+            DukObject obj(ctx);
+            obj.Set("queued", stats.NumQueued);
+            obj.Set("captured", stats.NumCaptured);
+            obj.Set("written", stats.NumWritten);
+            obj.Set("dropped", stats.NumDropped);
+            obj.Set("failed", stats.NumFailed);
+            obj.Set("bytesWritten", stats.BytesWritten);
+            obj.Set("averageRenderTime", stats.AverageRenderMs);
+            obj.Set("averageEncodeTime", stats.AverageEncodeMs);
+            obj.Set("encodeFramesPerSecond", stats.EncodeFramesPerSecond);
+            return obj.Take();
+        }
+
+        void resetCaptureStatistics()
+        {
+            CaptureQueue::ResetStatistics();
+        }
+
+        void flushCaptures()
+        {
+            CaptureQueue::Flush();
         }
 
         DukValue getObject(const std::string& typez, int32_t index) const
@@ -261,14 +300,57 @@ namespace OpenRCT2::Scripting
         //      Only ensuring it was not in the same generated method fixed it.
         __declspec(noinline)
 #    endif
-            std::shared_ptr<ScDisposable> CreateSubscription(HOOK_TYPE hookType, const DukValue& callback)
+            std::shared_ptr<ScDisposable> CreateSubscription(HOOK_TYPE hookType, const DukValue& callback, HookFilter filter)
         {
             auto owner = _execInfo.GetCurrentPlugin();
-            auto cookie = _hookEngine.Subscribe(hookType, owner, callback);
+            auto cookie = _hookEngine.Subscribe(hookType, owner, callback, std::move(filter));
             return std::make_shared<ScDisposable>([this, hookType, cookie]() { _hookEngine.Unsubscribe(hookType, cookie); });
         }
 
-        std::shared_ptr<ScDisposable> subscribe(const std::string& hook, const DukValue& callback)
+        static HookFilter GetHookFilter(duk_context* ctx, HOOK_TYPE hookType, const DukValue& options)
+        {
+            HookFilter filter;
+            if (options.type() != DukValue::Type::OBJECT)
+                return filter;
+
+            if (hookType != HOOK_TYPE::ACTION_QUERY && hookType != HOOK_TYPE::ACTION_EXECUTE)
+            {
+                duk_error(ctx, DUK_ERR_ERROR, "Options are only supported by action.query and action.execute.");
+            }
+
+            auto actions = options["actions"];
+            if (actions.is_array())
+            {
+                // An empty list would otherwise be the same as no filter and match every action
+                const auto actionNames = actions.as_array();
+                if (actionNames.empty())
+                {
+                    duk_error(ctx, DUK_ERR_ERROR, "Expected at least one action name.");
+                }
+                for (const auto& action : actionNames)
+                {
+                    if (action.type() != DukValue::Type::STRING)
+                    {
+                        duk_error(ctx, DUK_ERR_ERROR, "Expected action names.");
+                    }
+
+                    // Names that are not built-in actions are custom actions, which may be registered later
+                    const auto& name = action.as_string();
+                    if (auto type = GetGameActionType(name))
+                    {
+                        filter.ActionTypes.push_back(*type);
+                    }
+                    else
+                    {
+                        filter.CustomActions.push_back(name);
+                    }
+                }
+            }
+            filter.TopLevelOnly = AsOrDefault(options["topLevelOnly"], false);
+            return filter;
+        }
+
+        std::shared_ptr<ScDisposable> subscribe(const std::string& hook, const DukValue& callback, const DukValue& options)
         {
             auto& scriptEngine = GetContext()->GetScriptEngine();
             auto ctx = scriptEngine.GetContext();
@@ -295,7 +377,7 @@ namespace OpenRCT2::Scripting
                 duk_error(ctx, DUK_ERR_ERROR, "Hook type not available for this plugin type.");
             }
 
-            return CreateSubscription(hookType, callback);
+            return CreateSubscription(hookType, callback, GetHookFilter(ctx, hookType, options));
         }
 
         void queryAction(const std::string& action, const DukValue& args, const DukValue& callback)
@@ -434,6 +516,9 @@ namespace OpenRCT2::Scripting
             dukglue_register_method(ctx, &ScContext::getParkStorage, "getParkStorage");
             dukglue_register_property(ctx, &ScContext::mode_get, nullptr, "mode");
             dukglue_register_method(ctx, &ScContext::captureImage, "captureImage");
+            dukglue_register_method(ctx, &ScContext::getCaptureStatistics, "getCaptureStatistics");
+            dukglue_register_method(ctx, &ScContext::resetCaptureStatistics, "resetCaptureStatistics");
+            dukglue_register_method(ctx, &ScContext::flushCaptures, "flushCaptures");
             dukglue_register_method(ctx, &ScContext::getObject, "getObject");
             dukglue_register_method(ctx, &ScContext::getAllObjects, "getAllObjects");
             dukglue_register_method(ctx, &ScContext::getTrackSegment, "getTrackSegment");
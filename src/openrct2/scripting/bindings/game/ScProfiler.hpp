@@ -11,8 +11,10 @@
 
 #ifdef ENABLE_SCRIPTING
 
+#    include "../../../Context.h"
 #    include "../../../profiling/Profiling.h"
 #    include "../../Duktape.hpp"
+#    include "../../ScriptEngine.h"
 
 namespace OpenRCT2::Scripting
 {
@@ -50,6 +52,59 @@ namespace OpenRCT2::Scripting
             return DukValue::take_from_stack(_ctx);
         }
 
+        DukValue getMemoryData()
+        {
+            duk_push_array(_ctx);
+            duk_uarridx_t index = 0;
+            for (const auto& data : OpenRCT2::Profiling::GetMemoryData())
+            {
+                DukObject obj(_ctx);
+                obj.Set("name", data.Name);
+                obj.Set("currentBytes", data.CurrentBytes);
+                obj.Set("peakBytes", data.PeakBytes);
+                obj.Set("allocationCount", data.AllocationCount);
+                obj.Set("tickAllocationCount", data.TickAllocationCount);
+                obj.Set("tickAllocatedBytes", data.TickAllocatedBytes);
+                obj.Take().push();
+                duk_put_prop_index(_ctx, /* duk stack index */ -2, index);
+                index++;
+            }
+            return DukValue::take_from_stack(_ctx);
+        }
+
+        DukValue getPluginData()
+        {
+            auto& scriptEngine = GetContext()->GetScriptEngine();
+            duk_push_array(_ctx);
+            duk_uarridx_t index = 0;
+            for (const auto& plugin : scriptEngine.GetPlugins())
+            {
+                duk_push_array(_ctx);
+                duk_uarridx_t callIndex = 0;
+                for (const auto& timings : plugin->GetCallTimings())
+                {
+                    // Times are in microseconds like the profiled functions
+                    DukObject call(_ctx);
+                    call.Set("name", timings.Name);
+                    call.Set("callCount", timings.CallCount);
+                    call.Set("maxTime", timings.MaxMs * 1000.0);
+                    call.Set("totalTime", timings.TotalMs * 1000.0);
+                    call.Take().push();
+                    duk_put_prop_index(_ctx, /* duk stack index */ -2, callIndex);
+                    callIndex++;
+                }
+                auto calls = DukValue::take_from_stack(_ctx);
+
+                DukObject obj(_ctx);
+                obj.Set("name", plugin->GetMetadata().Name);
+                obj.Set("calls", calls);
+                obj.Take().push();
+                duk_put_prop_index(_ctx, /* duk stack index */ -2, index);
+                index++;
+            }
+            return DukValue::take_from_stack(_ctx);
+        }
+
         DukValue GetFunctionIndexArray(
             const std::vector<OpenRCT2::Profiling::Function*>& all, const std::vector<OpenRCT2::Profiling::Function*>& items)
         {
@@ -82,6 +137,7 @@ namespace OpenRCT2::Scripting
         void reset()
         {
             OpenRCT2::Profiling::ResetData();
+            GetContext()->GetScriptEngine().ResetPluginCallTimings();
         }
 
         bool enabled_get() const
@@ -89,6 +145,41 @@ namespace OpenRCT2::Scripting
             return OpenRCT2::Profiling::IsEnabled();
         }
 
+        void startTrace(int32_t numTicks)
+        {
+            OpenRCT2::Profiling::StartTrace(std::max(numTicks, 0));
+        }
+
+        void stopTrace()
+        {
+            OpenRCT2::Profiling::StopTrace();
+        }
+
+        std::string getTrace()
+        {
+            return OpenRCT2::Profiling::GetTrace();
+        }
+
+        bool tracing_get() const
+        {
+            return OpenRCT2::Profiling::IsTracing();
+        }
+
+        void startMemory()
+        {
+            OpenRCT2::Profiling::EnableMemoryTracking();
+        }
+
+        void stopMemory()
+        {
+            OpenRCT2::Profiling::DisableMemoryTracking();
+        }
+
+        bool memoryEnabled_get() const
+        {
+            return OpenRCT2::Profiling::IsMemoryTrackingEnabled();
+        }
+
     public:
         static void Register(duk_context* ctx)
         {
@@ -97,6 +188,15 @@ namespace OpenRCT2::Scripting
             dukglue_register_method(ctx, &ScProfiler::stop, "stop");
             dukglue_register_method(ctx, &ScProfiler::reset, "reset");
             dukglue_register_property(ctx, &ScProfiler::enabled_get, nullptr, "enabled");
+            dukglue_register_method(ctx, &ScProfiler::startTrace, "startTrace");
+            dukglue_register_method(ctx, &ScProfiler::stopTrace, "stopTrace");
+            dukglue_register_method(ctx, &ScProfiler::getTrace, "getTrace");
+            dukglue_register_property(ctx, &ScProfiler::tracing_get, nullptr, "tracing");
+            dukglue_register_method(ctx, &ScProfiler::getMemoryData, "getMemoryData");
+            dukglue_register_method(ctx, &ScProfiler::getPluginData, "getPluginData");
+            dukglue_register_method(ctx, &ScProfiler::startMemory, "startMemory");
+            dukglue_register_method(ctx, &ScProfiler::stopMemory, "stopMemory");
+            dukglue_register_property(ctx, &ScProfiler::memoryEnabled_get, nullptr, "memoryEnabled");
         }
     };
 } // namespace OpenRCT2::Scripting
@@ -34,8 +34,160 @@
 #    include "../ride/ScTrackIterator.h"
 #    include "../world/ScTile.hpp"
 
+#    include <algorithm>
+#    include <optional>
+
 namespace OpenRCT2::Scripting
 {
+    struct EntityQueryField
+    {
+        const char* Name;
+        int32_t (*Get)(const EntityBase& entity);
+    };
+
+    static int32_t GetEntityQueryRide(const EntityBase& entity)
+    {
+        RideId rideId = RideId::GetNull();
+        if (auto* vehicle = entity.As<Vehicle>(); vehicle != nullptr)
+        {
+            rideId = vehicle->ride;
+        }
+        else if (auto* peep = entity.As<Peep>(); peep != nullptr)
+        {
+            switch (peep->State)
+            {
+                case PeepState::QueuingFront:
+                case PeepState::Queuing:
+                case PeepState::EnteringRide:
+                case PeepState::OnRide:
+                case PeepState::LeavingRide:
+                    rideId = peep->CurrentRide;
+                    break;
+                default:
+                    break;
+            }
+        }
+        // Same as Car.ride, which is RideId::GetNull() for cars without a ride
+        return rideId.ToUnderlying();
+    }
+
+    static int32_t GetEntityQueryCash(const EntityBase& entity)
+    {
+        // Same as Guest.cash, which is narrowed to int32 by ScGuest::cash_get
+        return static_cast<int32_t>(static_cast<const Guest&>(entity).CashInPocket);
+    }
+
+    // clang-format off
+    // Field values are the same as the properties of the same name on the entity objects.
+    static constexpr EntityQueryField EntityQueryFields[] = {
+        { "id", [](const EntityBase& e) -> int32_t { return e.Id.ToUnderlying(); } },
+        { "x",  [](const EntityBase& e) -> int32_t { return e.x; } },
+        { "y",  [](const EntityBase& e) -> int32_t { return e.y; } },
+        { "z",  [](const EntityBase& e) -> int32_t { return e.z; } },
+    };
+
+    static constexpr EntityQueryField PeepQueryFields[] = {
+        { "energy",       [](const EntityBase& e) -> int32_t { return static_cast<const Peep&>(e).Energy; } },
+        { "energyTarget", [](const EntityBase& e) -> int32_t { return static_cast<const Peep&>(e).EnergyTarget; } },
+        { "ride",         GetEntityQueryRide },
+    };
+
+    static constexpr EntityQueryField GuestQueryFields[] = {
+        { "happiness",       [](const EntityBase& e) -> int32_t { return static_cast<const Guest&>(e).Happiness; } },
+        { "happinessTarget", [](const EntityBase& e) -> int32_t { return static_cast<const Guest&>(e).HappinessTarget; } },
+        { "nausea",          [](const EntityBase& e) -> int32_t { return static_cast<const Guest&>(e).Nausea; } },
+        { "nauseaTarget",    [](const EntityBase& e) -> int32_t { return static_cast<const Guest&>(e).NauseaTarget; } },
+        { "hunger",          [](const EntityBase& e) -> int32_t { return static_cast<const Guest&>(e).Hunger; } },
+        { "thirst",          [](const EntityBase& e) -> int32_t { return static_cast<const Guest&>(e).Thirst; } },
+        { "toilet",          [](const EntityBase& e) -> int32_t { return static_cast<const Guest&>(e).Toilet; } },
+        { "cash",            GetEntityQueryCash },
+        { "isInPark",        [](const EntityBase& e) -> int32_t { return !static_cast<const Guest&>(e).OutsideOfPark; } },
+    };
+
+    static constexpr EntityQueryField CarQueryFields[] = {
+        { "ride",          GetEntityQueryRide },
+        { "mass",          [](const EntityBase& e) -> int32_t { return static_cast<const Vehicle&>(e).mass; } },
+        { "acceleration",  [](const EntityBase& e) -> int32_t { return static_cast<const Vehicle&>(e).acceleration; } },
+        { "velocity",      [](const EntityBase& e) -> int32_t { return static_cast<const Vehicle&>(e).velocity; } },
+        { "trackProgress", [](const EntityBase& e) -> int32_t { return static_cast<const Vehicle&>(e).track_progress; } },
+    };
+    // clang-format on
+
+    static const EntityQueryField* FindEntityQueryField(std::string_view type, std::string_view name)
+    {
+        auto find = [name](const auto& fields) -> const EntityQueryField* {
+            auto it = std::find_if(
+                std::begin(fields), std::end(fields), [name](const EntityQueryField& field) { return field.Name == name; });
+            return it != std::end(fields) ? &*it : nullptr;
+        };
+
+        const EntityQueryField* field = find(EntityQueryFields);
+        if (field == nullptr && (type == "peep" || type == "guest" || type == "staff"))
+            field = find(PeepQueryFields);
+        if (field == nullptr && type == "guest")
+            field = find(GuestQueryFields);
+        if (field == nullptr && type == "car")
+            field = find(CarQueryFields);
+        return field;
+    }
+
+    /**
+     * Calls func for every entity of the given type, in the same order as getAllEntities.
+     * Returns false if the type is not valid.
+     */
+    template<typename TFunc> static bool ForEachEntityOfType(std::string_view type, TFunc&& func)
+    {
+        if (type == "balloon")
+        {
+            for (auto sprite : EntityList<Balloon>())
+                func(*sprite);
+        }
+        else if (type == "car")
+        {
+            for (auto trainHead : TrainManager::View())
+            {
+                for (auto carId = trainHead->Id; !carId.IsNull();)
+                {
+                    auto car = GetEntity<Vehicle>(carId);
+                    func(*car);
+                    carId = car->next_vehicle_on_train;
+                }
+            }
+        }
+        else if (type == "litter")
+        {
+            for (auto sprite : EntityList<Litter>())
+                func(*sprite);
+        }
+        else if (type == "duck")
+        {
+            for (auto sprite : EntityList<Duck>())
+                func(*sprite);
+        }
+        else if (type == "peep")
+        {
+            for (auto sprite : EntityList<Guest>())
+                func(*sprite);
+            for (auto sprite : EntityList<Staff>())
+                func(*sprite);
+        }
+        else if (type == "guest")
+        {
+            for (auto sprite : EntityList<Guest>())
+                func(*sprite);
+        }
+        else if (type == "staff")
+        {
+            for (auto sprite : EntityList<Staff>())
+                func(*sprite);
+        }
+        else
+        {
+            return false;
+        }
+        return true;
+    }
+
     ScMap::ScMap(duk_context* ctx)
         : _context(ctx)
     {
@@ -168,6 +320,128 @@ namespace OpenRCT2::Scripting
         return result;
     }
 
+    DukValue ScMap::queryEntities(const std::string& type, const DukValue& options) const
+    {
+        std::vector<const EntityQueryField*> fields;
+        auto dukFields = options["fields"];
+        if (!dukFields.is_array())
+        {
+            duk_error(_context, DUK_ERR_ERROR, "fields must be an array.");
+        }
+        for (const auto& dukField : dukFields.as_array())
+        {
+            auto name = AsOrDefault(dukField, "");
+            auto field = FindEntityQueryField(type, name);
+            if (field == nullptr)
+            {
+                duk_error(_context, DUK_ERR_ERROR, "Invalid field for %s: %s", type.c_str(), name.c_str());
+            }
+            fields.push_back(field);
+        }
+
+        std::optional<MapRange> range;
+        if (options["range"].type() == DukValue::Type::OBJECT)
+        {
+            range = FromDuk<MapRange>(options["range"]);
+        }
+        std::optional<int32_t> rideId;
+        if (options["ride"].type() == DukValue::Type::NUMBER)
+        {
+            rideId = options["ride"].as_int();
+        }
+
+        std::vector<const EntityBase*> entities;
+        auto isValidType = ForEachEntityOfType(type, [&](const EntityBase& entity) {
+            if (range.has_value() && (entity.x == LOCATION_NULL || !range->Contains({ entity.x, entity.y })))
+                return;
+            if (rideId.has_value() && GetEntityQueryRide(entity) != *rideId)
+                return;
+            entities.push_back(&entity);
+        });
+        if (!isValidType)
+        {
+            duk_error(_context, DUK_ERR_ERROR, "Invalid entity type: %s", type.c_str());
+        }
+
+        // Each field is returned as one typed array, so reading it from a script does not create an object per entity
+        DukObject result(_context);
+        result.Set("count", static_cast<int32_t>(entities.size()));
+        std::vector<int32_t> values(entities.size());
+        for (const auto* field : fields)
+        {
+            for (size_t i = 0; i < entities.size(); i++)
+            {
+                values[i] = field->Get(*entities[i]);
+            }
+            result.Set(field->Name, ToDukTypedArray(_context, values));
+        }
+        return result.Take();
+    }
+
+    static int16_t GetTileQueryRide(const TileElement& tileElement)
+    {
+        // Paths that are not queues can still have a ride index stored
+        auto* pathElement = tileElement.AsPath();
+        if (pathElement != nullptr && !pathElement->IsQueue())
+            return -1;
+
+        auto rideIndex = tileElement.GetRideIndex();
+        return rideIndex.IsNull() ? -1 : static_cast<int16_t>(rideIndex.ToUnderlying());
+    }
+
+    DukValue ScMap::queryTiles(const DukValue& dukRange) const
+    {
+        auto range = FromDuk<MapRange>(dukRange);
+        auto left = std::max(0, range.GetLeft() / COORDS_XY_STEP);
+        auto top = std::max(0, range.GetTop() / COORDS_XY_STEP);
+        auto right = std::min(gMapSize.x - 1, range.GetRight() / COORDS_XY_STEP);
+        auto bottom = std::min(gMapSize.y - 1, range.GetBottom() / COORDS_XY_STEP);
+        auto width = std::max(0, right - left + 1);
+        auto height = std::max(0, bottom - top + 1);
+
+        std::vector<uint32_t> offsets;
+        std::vector<uint8_t> types;
+        std::vector<uint8_t> baseHeights;
+        std::vector<uint8_t> clearanceHeights;
+        std::vector<int16_t> rides;
+        std::vector<uint8_t> ghosts;
+        offsets.reserve(static_cast<size_t>(width) * height + 1);
+        for (int32_t y = top; y < top + height; y++)
+        {
+            for (int32_t x = left; x < left + width; x++)
+            {
+                offsets.push_back(static_cast<uint32_t>(types.size()));
+
+                auto* tileElement = MapGetFirstElementAt(TileCoordsXY{ x, y });
+                if (tileElement == nullptr)
+                    continue;
+                do
+                {
+                    types.push_back(EnumValue(tileElement->GetType()));
+                    baseHeights.push_back(tileElement->BaseHeight);
+                    clearanceHeights.push_back(tileElement->ClearanceHeight);
+                    rides.push_back(GetTileQueryRide(*tileElement));
+                    ghosts.push_back(tileElement->IsGhost());
+                } while (!(tileElement++)->IsLastForTile());
+            }
+        }
+        offsets.push_back(static_cast<uint32_t>(types.size()));
+
+        DukObject result(_context);
+        result.Set("x", left);
+        result.Set("y", top);
+        result.Set("width", width);
+        result.Set("height", height);
+        result.Set("count", static_cast<int32_t>(types.size()));
+        result.Set("offsets", ToDukTypedArray(_context, offsets));
+        result.Set("type", ToDukTypedArray(_context, types));
+        result.Set("baseHeight", ToDukTypedArray(_context, baseHeights));
+        result.Set("clearanceHeight", ToDukTypedArray(_context, clearanceHeights));
+        result.Set("ride", ToDukTypedArray(_context, rides));
+        result.Set("isGhost", ToDukTypedArray(_context, ghosts));
+        return result.Take();
+    }
+
     std::vector<DukValue> OpenRCT2::Scripting::ScMap::getAllEntitiesOnTile(
         const std::string& type, const DukValue& tilePos) const
     {
@@ -325,6 +599,8 @@ namespace OpenRCT2::Scripting
         dukglue_register_method(ctx, &ScMap::getEntity, "getEntity");
         dukglue_register_method(ctx, &ScMap::getAllEntities, "getAllEntities");
         dukglue_register_method(ctx, &ScMap::getAllEntitiesOnTile, "getAllEntitiesOnTile");
+        dukglue_register_method(ctx, &ScMap::queryEntities, "queryEntities");
+        dukglue_register_method(ctx, &ScMap::queryTiles, "queryTiles");
         dukglue_register_method(ctx, &ScMap::createEntity, "createEntity");
         dukglue_register_method(ctx, &ScMap::getTrackIterator, "getTrackIterator");
     }
@@ -45,6 +45,10 @@ namespace OpenRCT2::Scripting
 
         std::vector<DukValue> getAllEntitiesOnTile(const std::string& type, const DukValue& tilePos) const;
 
+        DukValue queryEntities(const std::string& type, const DukValue& options) const;
+
+        DukValue queryTiles(const DukValue& range) const;
+
         DukValue createEntity(const std::string& type, const DukValue& initializer);
 
         DukValue getTrackIterator(const DukValue& position, int32_t elementIndex) const;
@@ -50,20 +50,52 @@ namespace OpenRCT2::Scripting
         return static_cast<int32_t>(GetNumElements(first));
     }
 
-    std::vector<std::shared_ptr<ScTileElement>> ScTile::elements_get() const
+    // Returns an array that only creates the wrapper for an element when its index is first read. The array is filled
+    // with undefined rather than left with holes so that the array methods still visit every element.
+    static constexpr const char* LazyElementsFactorySource = R"(
+function (tile, count) {
+    var elements = new Array(count);
+    for (var i = 0; i < count; i++) {
+        elements[i] = undefined;
+    }
+    return new Proxy(elements, {
+        get: function (target, key) {
+            // Duktape passes array indices as numbers, other engines as strings
+            var index = typeof key === 'number' ? key : (typeof key === 'string' ? Number(key) : NaN);
+            if (index >= 0 && index < count && index % 1 === 0 && target[index] === undefined) {
+                target[index] = tile.getElement(index);
+            }
+            return target[key];
+        }
+    });
+})";
+    static constexpr const char* LazyElementsFactoryKey = "ScTile.lazyElementsFactory";
+
+    static void PushLazyElementsFactory(duk_context* ctx)
     {
-        std::vector<std::shared_ptr<ScTileElement>> result;
-        auto first = GetFirstElement();
-        auto currentNumElements = GetNumElements(first);
-        if (currentNumElements != 0)
+        duk_push_global_stash(ctx);
+        if (!duk_get_prop_string(ctx, -1, LazyElementsFactoryKey))
         {
-            result.reserve(currentNumElements);
-            for (size_t i = 0; i < currentNumElements; i++)
-            {
-                result.push_back(std::make_shared<ScTileElement>(_coords, &first[i]));
-            }
+            duk_pop(ctx);
+            duk_push_string(ctx, "ScTile.elements");
+            duk_compile_string_filename(ctx, DUK_COMPILE_FUNCTION, LazyElementsFactorySource);
+            duk_dup_top(ctx);
+            duk_put_prop_string(ctx, -3, LazyElementsFactoryKey);
         }
-        return result;
+        duk_remove(ctx, -2);
+    }
+
+    DukValue ScTile::elements_get() const
+    {
+        auto ctx = GetDukContext();
+        auto tile = GetObjectAsDukValue(ctx, std::make_shared<ScTile>(_coords));
+        auto numElements = GetNumElements(GetFirstElement());
+
+        PushLazyElementsFactory(ctx);
+        tile.push();
+        duk_push_uint(ctx, static_cast<duk_uint_t>(numElements));
+        duk_call(ctx, 2);
+        return DukValue::take_from_stack(ctx);
     }
 
     DukValue ScTile::data_get() const
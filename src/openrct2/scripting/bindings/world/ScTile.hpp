@@ -38,7 +38,7 @@ namespace OpenRCT2::Scripting
 
         uint32_t numElements_get() const;
 
-        std::vector<std::shared_ptr<ScTileElement>> elements_get() const;
+        DukValue elements_get() const;
 
         DukValue data_get() const;
         void data_set(DukValue value);
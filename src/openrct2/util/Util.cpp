@@ -331,9 +331,19 @@ char* SafeStrCat(char* destination, const char* source, size_t size)
     return result;
 }
 
+static thread_local std::mt19937 _prng{ std::random_device{}() };
+static thread_local std::mt19937 _prngNormal{ std::random_device{}() };
+static thread_local std::normal_distribution<float> _distributor{ 0.0f, 1.0f };
+
+void UtilSrand(uint32_t seed)
+{
+    _prng.seed(seed);
+    _prngNormal.seed(seed);
+    _distributor.reset();
+}
+
 uint32_t UtilRand()
 {
-    thread_local std::mt19937 _prng(std::random_device{}());
     return _prng();
 }
 
@@ -341,9 +351,7 @@ uint32_t UtilRand()
 // TODO: In C++20 this can be templated, where the standard deviation is passed as a value template argument.
 float UtilRandNormalDistributed()
 {
-    thread_local std::mt19937 _prng{ std::random_device{}() };
-    thread_local std::normal_distribution<float> _distributor{ 0.0f, 1.0f };
-    return _distributor(_prng);
+    return _distributor(_prngNormal);
 }
 
 constexpr size_t CHUNK = 128 * 1024;
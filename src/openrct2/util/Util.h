@@ -33,6 +33,8 @@ int32_t StrLogicalCmp(char const* a, char const* b);
 char* SafeStrCpy(char* destination, const char* source, size_t num);
 char* SafeStrCat(char* destination, const char* source, size_t size);
 
+// Seeds the random number generators of the calling thread, only meant for reproducible benchmarks.
+void UtilSrand(uint32_t seed);
 uint32_t UtilRand();
 float UtilRandNormalDistributed();
 
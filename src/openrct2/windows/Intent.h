@@ -47,6 +47,7 @@ enum IntentAction
     INTENT_ACTION_TRACK_DESIGN_RESTORE_PROVISIONAL,
     INTENT_ACTION_SET_MAP_TOOLTIP,
     INTENT_ACTION_NEW_SCENERY,
+    INTENT_ACTION_UPDATE_GUEST_LIST,
 
     INTENT_ACTION_NULL = 255,
 };
@@ -815,6 +815,11 @@ struct MapRange : public RectRange<CoordsXY>
             std::max(GetTop(), GetBottom()));
         return result;
     }
+
+    constexpr bool Contains(const CoordsXY& coords) const
+    {
+        return coords.x >= GetLeft() && coords.x <= GetRight() && coords.y >= GetTop() && coords.y <= GetBottom();
+    }
 };
 
 /**
@@ -107,43 +107,48 @@ uint32_t gLandRemainingConstructionSales;
 
 bool gMapLandRightsUpdateSuccess;
 
-static TilePointerIndex<TileElement> _tileIndex;
-static std::vector<TileElement> _tileElements;
-static TilePointerIndex<TileElement> _tileIndexStash;
-static std::vector<TileElement> _tileElementsStash;
-static size_t _tileElementsInUse;
-static size_t _tileElementsInUseStash;
-static TileCoordsXY _mapSizeStash;
-static int32_t _currentRotationStash;
+static MapState _mainMapState;
+static MapState* _activeMapState = &_mainMapState;
 
-void StashMap()
+static void UpdateTileElementsMemoryUsage()
 {
-    _tileIndexStash = std::move(_tileIndex);
-    _tileElementsStash = std::move(_tileElements);
-    _mapSizeStash = gMapSize;
-    _currentRotationStash = gCurrentRotation;
-    _tileElementsInUseStash = _tileElementsInUse;
+    auto capacity = _mainMapState.TileElements.capacity();
+    if (_activeMapState != &_mainMapState)
+        capacity += _activeMapState->TileElements.capacity();
+    Profiling::SetMemoryUsage(Profiling::MemoryTag::TileElements, capacity * sizeof(TileElement));
 }
 
-void UnstashMap()
+MapState& GetActiveMapState()
 {
-    _tileIndex = std::move(_tileIndexStash);
-    _tileElements = std::move(_tileElementsStash);
-    gMapSize = _mapSizeStash;
-    gCurrentRotation = _currentRotationStash;
-    _tileElementsInUse = _tileElementsInUseStash;
+    return *_activeMapState;
+}
+
+MapState& SetActiveMapState(MapState& state)
+{
+    auto& previousState = *_activeMapState;
+    previousState.MapSize = gMapSize;
+    previousState.CurrentRotation = gCurrentRotation;
+
+    _activeMapState = &state;
+    gMapSize = state.MapSize;
+    gCurrentRotation = state.CurrentRotation;
+    UpdateTileElementsMemoryUsage();
+    return previousState;
 }
 
 const std::vector<TileElement>& GetTileElements()
 {
-    return _tileElements;
+    return _activeMapState->TileElements;
 }
 
 void SetTileElements(std::vector<TileElement>&& tileElements)
 {
-    _tileElements = std::move(tileElements);
-    _tileIndex = TilePointerIndex<TileElement>(MAXIMUM_MAP_SIZE_TECHNICAL, _tileElements.data(), _tileElements.size());
-    _tileElementsInUse = _tileElements.size();
+    auto& state = *_activeMapState;
+    state.TileElements = std::move(tileElements);
+    state.TileIndex = TilePointerIndex<TileElement>(
+        MAXIMUM_MAP_SIZE_TECHNICAL, state.TileElements.data(), state.TileElements.size());
+    state.TileElementsInUse = state.TileElements.size();
+    UpdateTileElementsMemoryUsage();
 }
 
 static TileElement GetDefaultSurfaceElement()
@@ -166,7 +171,7 @@ static TileElement GetDefaultSurfaceElement()
 std::vector<TileElement> GetReorganisedTileElementsWithoutGhosts()
 {
     std::vector<TileElement> newElements;
-    newElements.reserve(std::max(MIN_TILE_ELEMENTS, _tileElements.size()));
+    newElements.reserve(std::max(MIN_TILE_ELEMENTS, _activeMapState->TileElements.size()));
     for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
     {
         for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
@@ -231,30 +236,31 @@ static void ReorganiseTileElements(size_t capacity)
 
 void ReorganiseTileElements()
 {
-    ReorganiseTileElements(_tileElements.size());
+    ReorganiseTileElements(_activeMapState->TileElements.size());
 }
 
 static bool MapCheckFreeElementsAndReorganise(size_t numElementsOnTile, size_t numNewElements)
 {
-    // Check hard cap on num in use tiles (this would be the size of _tileElements immediately after a reorg)
-    if (_tileElementsInUse + numNewElements > MAX_TILE_ELEMENTS)
+    // Check hard cap on num in use tiles (this would be the size of TileElements immediately after a reorg)
+    if (_activeMapState->TileElementsInUse + numNewElements > MAX_TILE_ELEMENTS)
     {
         return false;
     }
 
     auto totalElementsRequired = numElementsOnTile + numNewElements;
-    auto freeElements = _tileElements.capacity() - _tileElements.size();
+    auto& tileElements = _activeMapState->TileElements;
+    auto freeElements = tileElements.capacity() - tileElements.size();
     if (freeElements >= totalElementsRequired)
     {
         return true;
     }
 
     // if space issue is due to fragmentation then Reorg Tiles without increasing capacity
-    if (_tileElements.size() > totalElementsRequired + _tileElementsInUse)
+    if (tileElements.size() > totalElementsRequired + _activeMapState->TileElementsInUse)
     {
         ReorganiseTileElements();
         // This check is not expected to fail
-        freeElements = _tileElements.capacity() - _tileElements.size();
+        freeElements = tileElements.capacity() - tileElements.size();
         if (freeElements >= totalElementsRequired)
         {
             return true;
@@ -262,7 +268,7 @@ static bool MapCheckFreeElementsAndReorganise(size_t numElementsOnTile, size_t n
     }
 
     // Capacity must increase to handle the space (Note capacity can go above MAX_TILE_ELEMENTS)
-    auto newCapacity = _tileElements.capacity() * 2;
+    auto newCapacity = tileElements.capacity() * 2;
     ReorganiseTileElements(newCapacity);
     return true;
 }
@@ -336,7 +342,7 @@ TileElement* MapGetFirstElementAt(const TileCoordsXY& tilePos)
         LOG_VERBOSE("Trying to access element outside of range");
         return nullptr;
     }
-    return _tileIndex.GetFirstElementAt(tilePos);
+    return _activeMapState->TileIndex.GetFirstElementAt(tilePos);
 }
 
 TileElement* MapGetFirstElementAt(const CoordsXY& elementPos)
@@ -394,7 +400,7 @@ void MapSetTileElement(const TileCoordsXY& tilePos, TileElement* elements)
         LOG_ERROR("Trying to access element outside of range");
         return;
     }
-    _tileIndex.SetTile(tilePos, elements);
+    _activeMapState->TileIndex.SetTile(tilePos, elements);
 }
 
 SurfaceElement* MapGetSurfaceElementAt(const TileCoordsXY& coords)
@@ -508,7 +514,7 @@ void MapCountRemainingLandRights()
  */
 void MapStripGhostFlagFromElements()
 {
-    for (auto& element : _tileElements)
+    for (auto& element : _activeMapState->TileElements)
     {
         element.SetGhost(false);
     }
@@ -1005,10 +1011,10 @@ void TileElementRemove(TileElement* tileElement)
     // Mark the latest element with the last element flag.
     (tileElement - 1)->SetLastForTile(true);
     tileElement->BaseHeight = MAX_ELEMENT_HEIGHT;
-    _tileElementsInUse--;
-    if (tileElement == &_tileElements.back())
+    _activeMapState->TileElementsInUse--;
+    if (tileElement == &_activeMapState->TileElements.back())
     {
-        _tileElements.pop_back();
+        _activeMapState->TileElements.pop_back();
     }
 }
 
@@ -1117,7 +1123,7 @@ void MapInvalidateSelectionRect()
 static size_t CountElementsOnTile(const CoordsXY& loc)
 {
     size_t count = 0;
-    auto* element = _tileIndex.GetFirstElementAt(TileCoordsXY(loc));
+    auto* element = _activeMapState->TileIndex.GetFirstElementAt(TileCoordsXY(loc));
     do
     {
         count++;
@@ -1133,10 +1139,16 @@ static TileElement* AllocateTileElements(size_t numElementsOnTile, size_t numNew
         return nullptr;
     }
 
-    auto oldSize = _tileElements.size();
-    _tileElements.resize(_tileElements.size() + numElementsOnTile + numNewElements);
-    _tileElementsInUse += numNewElements;
-    return &_tileElements[oldSize];
+    auto& state = *_activeMapState;
+    auto oldSize = state.TileElements.size();
+    auto oldCapacity = state.TileElements.capacity();
+    state.TileElements.resize(state.TileElements.size() + numElementsOnTile + numNewElements);
+    state.TileElementsInUse += numNewElements;
+    if (state.TileElements.capacity() != oldCapacity)
+    {
+        UpdateTileElementsMemoryUsage();
+    }
+    return &state.TileElements[oldSize];
 }
 
 /**
@@ -1149,14 +1161,14 @@ TileElement* TileElementInsert(const CoordsXYZ& loc, int32_t occupiedQuadrants,
 
     auto numElementsOnTileOld = CountElementsOnTile(loc);
     auto* newTileElement = AllocateTileElements(numElementsOnTileOld, 1);
-    auto* originalTileElement = _tileIndex.GetFirstElementAt(tileLoc);
+    auto* originalTileElement = _activeMapState->TileIndex.GetFirstElementAt(tileLoc);
     if (newTileElement == nullptr)
     {
         return nullptr;
     }
 
     // Set tile index pointer to point to new element block
-    _tileIndex.SetTile(tileLoc, newTileElement);
+    _activeMapState->TileIndex.SetTile(tileLoc, newTileElement);
 
     bool isLastForTile = false;
     if (originalTileElement == nullptr)
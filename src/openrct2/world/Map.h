@@ -12,6 +12,7 @@
 #include "../common.h"
 #include "Location.hpp"
 #include "TileElement.h"
+#include "TilePointerIndex.hpp"
 
 #include <initializer_list>
 #include <vector>
@@ -146,11 +147,48 @@ extern uint32_t gLandRemainingConstructionSales;
 
 extern bool gMapLandRightsUpdateSuccess;
 
+/**
+ * The tile elements of a map. The map functions operate on the active state, other states such as
+ * the scratch map of the track design preview can be made active while they are being used.
+ */
+struct MapState
+{
+    TilePointerIndex<TileElement> TileIndex;
+    std::vector<TileElement> TileElements;
+    size_t TileElementsInUse{};
+    TileCoordsXY MapSize{};
+    int32_t CurrentRotation{};
+};
+
+MapState& GetActiveMapState();
+
+// Makes the given state active, returning the previously active state.
+MapState& SetActiveMapState(MapState& state);
+
+// Makes the given state active until the end of the scope, the state has to outlive the scope.
+class ScopedActiveMapState
+{
+private:
+    MapState& _previousState;
+
+public:
+    ScopedActiveMapState(MapState& state)
+        : _previousState(SetActiveMapState(state))
+    {
+    }
+
+    ~ScopedActiveMapState()
+    {
+        SetActiveMapState(_previousState);
+    }
+
+    ScopedActiveMapState(const ScopedActiveMapState&) = delete;
+    ScopedActiveMapState& operator=(const ScopedActiveMapState&) = delete;
+};
+
 void ReorganiseTileElements();
 const std::vector<TileElement>& GetTileElements();
 void SetTileElements(std::vector<TileElement>&& tileElements);
-void StashMap();
-void UnstashMap();
 std::vector<TileElement> GetReorganisedTileElementsWithoutGhosts();
 
 void MapInit(const TileCoordsXY& size);
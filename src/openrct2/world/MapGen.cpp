@@ -14,6 +14,7 @@
 #include "../common.h"
 #include "../core/Guard.hpp"
 #include "../core/Imaging.h"
+#include "../core/JobPool.h"
 #include "../core/String.hpp"
 #include "../localisation/Localisation.h"
 #include "../localisation/StringIds.h"
@@ -34,6 +35,8 @@
 #include <cmath>
 #include <cstring>
 #include <iterator>
+#include <memory>
+#include <thread>
 #include <vector>
 
 #pragma region Height map struct
@@ -102,6 +105,44 @@ static void MapGenSimplex(MapGenSettings* settings);
 static TileCoordsXY _heightSize;
 static uint8_t* _height;
 
+static std::unique_ptr<JobPool> _mapGenJobs;
+
+/**
+ * Calls fn for every row from begin up to end, split into chunks that run in parallel. fn may only write to its own row.
+ */
+template<typename TFn> static void MapGenForEachRow(int32_t begin, int32_t end, const TFn& fn)
+{
+    constexpr int32_t MinRowsPerChunk = 16;
+    const auto numThreads = static_cast<int32_t>(std::thread::hardware_concurrency());
+    if (numThreads <= 1 || end - begin < MinRowsPerChunk * 2)
+    {
+        for (auto y = begin; y < end; y++)
+        {
+            fn(y);
+        }
+        return;
+    }
+
+    if (_mapGenJobs == nullptr)
+    {
+        _mapGenJobs = std::make_unique<JobPool>();
+    }
+
+    // A few chunks per thread so that rows which take longer do not leave threads idle
+    const auto rowsPerChunk = std::max(MinRowsPerChunk, (end - begin) / (numThreads * 4));
+    for (auto chunkBegin = begin; chunkBegin < end; chunkBegin += rowsPerChunk)
+    {
+        const auto chunkEnd = std::min(end, chunkBegin + rowsPerChunk);
+        _mapGenJobs->AddTask([&fn, chunkBegin, chunkEnd]() {
+            for (auto y = chunkBegin; y < chunkEnd; y++)
+            {
+                fn(y);
+            }
+        });
+    }
+    _mapGenJobs->Join();
+}
+
 static int32_t GetHeight(int32_t x, int32_t y)
 {
     if (x >= 0 && y >= 0 && x < _heightSize.x && y < _heightSize.y)
@@ -431,32 +472,25 @@ static void MapGenSetWaterLevel(int32_t waterLevel)
  */
 static void MapGenSmoothHeight(int32_t iterations)
 {
-    int32_t i, x, y, xx, yy, avg;
-    int32_t arraySize = _heightSize.y * _heightSize.x * sizeof(uint8_t);
-    uint8_t* copyHeight = new uint8_t[arraySize];
-
-    for (i = 0; i < iterations; i++)
-    {
-        std::memcpy(copyHeight, _height, arraySize);
-        for (y = 1; y < _heightSize.y - 1; y++)
-        {
-            for (x = 1; x < _heightSize.x - 1; x++)
+    const auto width = _heightSize.x;
+    std::vector<uint8_t> copyHeight(_heightSize.y * width);
+
+    for (int32_t i = 0; i < iterations; i++)
+    {
+        std::copy_n(_height, copyHeight.size(), copyHeight.data());
+        MapGenForEachRow(1, _heightSize.y - 1, [width, &copyHeight](int32_t y) {
+            const uint8_t* above = &copyHeight[(y - 1) * width];
+            const uint8_t* row = &copyHeight[y * width];
+            const uint8_t* below = &copyHeight[(y + 1) * width];
+            uint8_t* dst = &_height[y * width];
+            for (int32_t x = 1; x < width - 1; x++)
             {
-                avg = 0;
-                for (yy = -1; yy <= 1; yy++)
-                {
-                    for (xx = -1; xx <= 1; xx++)
-                    {
-                        avg += copyHeight[(y + yy) * _heightSize.x + (x + xx)];
-                    }
-                }
-                avg /= 9;
-                SetHeight(x, y, avg);
+                int32_t sum = above[x - 1] + above[x] + above[x + 1] + row[x - 1] + row[x] + row[x + 1] + below[x - 1]
+                    + below[x] + below[x + 1];
+                dst[x] = sum / 9;
             }
-        }
+        });
     }
-
-    delete[] copyHeight;
 }
 
 /**
@@ -543,6 +577,27 @@ static float FractalNoise(int32_t x, int32_t y, float frequency, int32_t octaves
     return total;
 }
 
+/**
+ * Calculates the fractal noise for a whole row at once, so the loop over the tiles is innermost and only depends on x.
+ * The octaves are summed in the same order as for a single tile, which keeps the result identical.
+ */
+static void FractalNoiseRow(
+    int32_t y, float* row, int32_t width, float frequency, int32_t octaves, float lacunarity, float persistence)
+{
+    std::fill_n(row, width, 0.0f);
+    float amplitude = persistence;
+    for (int32_t i = 0; i < octaves; i++)
+    {
+        const float fy = y * frequency;
+        for (int32_t x = 0; x < width; x++)
+        {
+            row[x] += Generate(x * frequency, fy) * amplitude;
+        }
+        frequency *= lacunarity;
+        amplitude *= persistence;
+    }
+}
+
 static float Generate(float x, float y)
 {
     const float F2 = 0.366025403f; // F2 = 0.5*(sqrt(3.0)-1.0)
@@ -644,8 +699,6 @@ static float Grad(int32_t hash, float x, float y)
 
 static void MapGenSimplex(MapGenSettings* settings)
 {
-    int32_t x, y;
-
     float freq = settings->simplex_base_freq * (1.0f / _heightSize.x);
     int32_t octaves = settings->simplex_octaves;
 
@@ -653,16 +706,18 @@ static void MapGenSimplex(MapGenSettings* settings)
     int32_t high = settings->simplex_high;
 
     NoiseRand();
-    for (y = 0; y < _heightSize.y; y++)
-    {
-        for (x = 0; x < _heightSize.x; x++)
+    const auto width = _heightSize.x;
+    MapGenForEachRow(0, _heightSize.y, [=](int32_t y) {
+        std::vector<float> noiseRow(width);
+        FractalNoiseRow(y, noiseRow.data(), width, freq, octaves, 2.0f, 0.65f);
+        for (int32_t x = 0; x < width; x++)
         {
-            float noiseValue = std::clamp(FractalNoise(x, y, freq, octaves, 2.0f, 0.65f), -1.0f, 1.0f);
+            float noiseValue = std::clamp(noiseRow[x], -1.0f, 1.0f);
             float normalisedNoiseValue = (noiseValue + 1.0f) / 2.0f;
 
             SetHeight(x, y, low + static_cast<int32_t>(normalisedNoiseValue * high));
         }
-    }
+    });
 }
 
 #pragma endregion
@@ -757,8 +812,7 @@ static void MapGenSmoothHeightmap(std::vector<uint8_t>& src, int32_t strength)
     for (int32_t i = 0; i < strength; i++)
     {
         // Calculate box blur value to all pixels of the surface
-        for (uint32_t y = 0; y < _heightMapData.height; y++)
-        {
+        MapGenForEachRow(0, static_cast<int32_t>(_heightMapData.height), [&src, &dest](int32_t y) {
             for (uint32_t x = 0; x < _heightMapData.width; x++)
             {
                 uint32_t heightSum = 0;
@@ -779,16 +833,10 @@ static void MapGenSmoothHeightmap(std::vector<uint8_t>& src, int32_t strength)
                 // Take average
                 dest[x + y * _heightMapData.width] = heightSum / 9;
             }
-        }
+        });
 
         // Now apply the blur to the source pixels
-        for (uint32_t y = 0; y < _heightMapData.height; y++)
-        {
-            for (uint32_t x = 0; x < _heightMapData.width; x++)
-            {
-                src[x + y * _heightMapData.width] = dest[x + y * _heightMapData.width];
-            }
-        }
+        std::swap(src, dest);
     }
 }
 
@@ -0,0 +1,88 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/core/File.h>
+#include <openrct2/core/FileSystem.hpp>
+#include <openrct2/interface/CaptureQueue.h>
+#include <vector>
+
+TEST(CaptureQueueTest, DropsFramesWhenAllBuffersAreOutstanding)
+{
+    CaptureQueue::ResetStatistics();
+    {
+        std::vector<CaptureFramePtr> frames;
+        for (size_t i = 0; i < CaptureQueue::NumFrameBuffers; i++)
+        {
+            frames.push_back(CaptureQueue::AcquireFrame());
+            ASSERT_NE(frames.back().get(), nullptr);
+        }
+
+        ASSERT_EQ(CaptureQueue::AcquireFrame().get(), nullptr);
+        ASSERT_EQ(CaptureQueue::AcquireFrame().get(), nullptr);
+        ASSERT_EQ(CaptureQueue::GetStatistics().NumDropped, 2u);
+    }
+    ASSERT_EQ(CaptureQueue::GetStatistics().NumCaptured, 0u);
+}
+
+TEST(CaptureQueueTest, ReleasedFrameReturnsToPool)
+{
+    CaptureQueue::ResetStatistics();
+    std::vector<CaptureFramePtr> frames;
+    for (size_t i = 0; i < CaptureQueue::NumFrameBuffers; i++)
+    {
+        frames.push_back(CaptureQueue::AcquireFrame());
+        ASSERT_NE(frames.back().get(), nullptr);
+    }
+
+    // Releasing a frame without submitting it makes its buffer available again
+    auto* released = frames.back().get();
+    frames.pop_back();
+    frames.push_back(CaptureQueue::AcquireFrame());
+    ASSERT_EQ(frames.back().get(), released);
+    ASSERT_EQ(CaptureQueue::AcquireFrame().get(), nullptr);
+    ASSERT_EQ(CaptureQueue::GetStatistics().NumDropped, 1u);
+}
+
+TEST(CaptureQueueTest, WriteRawFrame)
+{
+    CaptureFrame frame;
+    frame.Path = (fs::temp_directory_path() / "openrct2_capture_queue_test.raw").u8string();
+    frame.Format = CaptureFormat::Raw;
+    frame.Width = 3;
+    frame.Height = 2;
+    for (int32_t i = 0; i < PALETTE_SIZE; i++)
+    {
+        frame.Palette[i] = { static_cast<uint8_t>(i), static_cast<uint8_t>(i + 1), static_cast<uint8_t>(i + 2), 255 };
+    }
+    frame.Pixels = { 0, 1, 2, 253, 254, 255 };
+    ASSERT_TRUE(CaptureQueue::WriteFrame(frame));
+
+    auto data = File::ReadAllBytes(frame.Path);
+    File::Delete(frame.Path);
+
+    const std::vector<uint8_t> header = {
+        'T', 'R', 'C', 'F', // Magic
+        1,   0,   0,   0,   // Version
+        3,   0,   0,   0,   // Width
+        2,   0,   0,   0,   // Height
+    };
+    const auto paletteSize = PALETTE_SIZE * 4;
+    ASSERT_EQ(data.size(), header.size() + paletteSize + frame.Pixels.size());
+    ASSERT_EQ(std::vector<uint8_t>(data.begin(), data.begin() + header.size()), header);
+    for (int32_t i = 0; i < PALETTE_SIZE; i++)
+    {
+        const auto* entry = &data[header.size() + i * 4];
+        ASSERT_EQ(entry[0], frame.Palette[i].Blue);
+        ASSERT_EQ(entry[1], frame.Palette[i].Green);
+        ASSERT_EQ(entry[2], frame.Palette[i].Red);
+        ASSERT_EQ(entry[3], frame.Palette[i].Alpha);
+    }
+    ASSERT_EQ(std::vector<uint8_t>(data.begin() + header.size() + paletteSize, data.end()), frame.Pixels);
+}
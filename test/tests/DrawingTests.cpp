@@ -0,0 +1,179 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <array>
+#include <gtest/gtest.h>
+#include <openrct2/drawing/Drawing.h>
+#include <openrct2/drawing/MinifiedSpriteCache.h>
+#include <openrct2/sprites.h>
+#include <openrct2/util/Util.h>
+#include <random>
+#include <vector>
+
+using BlitRleRunFunc = void (*)(const uint8_t*, uint8_t*, int32_t, int32_t, const PaletteMap*);
+
+static void CompareWithScalar(BlitRleRunFunc func)
+{
+    std::array<uint8_t, 256> map;
+    for (size_t i = 0; i < map.size(); i++)
+    {
+        // Remap some pixels to transparent
+        map[i] = (i % 7) == 0 ? 0 : static_cast<uint8_t>(255 - i);
+    }
+    PaletteMap paletteMap(map.data(), 1, static_cast<uint16_t>(map.size()));
+
+    std::mt19937 random(0);
+    for (int32_t i = 0; i < 10000; i++)
+    {
+        std::array<uint8_t, 160> src;
+        for (auto& pixel : src)
+        {
+            pixel = (random() % 4) == 0 ? 0 : static_cast<uint8_t>(random());
+        }
+        std::array<uint8_t, 160> expected;
+        for (auto& pixel : expected)
+        {
+            pixel = static_cast<uint8_t>(random());
+        }
+        auto actual = expected;
+
+        const auto numPixels = static_cast<int32_t>(random() % 128);
+        const auto zoomShift = static_cast<int32_t>(random() % 4);
+        const auto* remap = (random() % 2) == 0 ? &paletteMap : nullptr;
+        BlitRleRunScalar(src.data(), expected.data(), numPixels, zoomShift, remap);
+        func(src.data(), actual.data(), numPixels, zoomShift, remap);
+        ASSERT_EQ(expected, actual) << "numPixels " << numPixels << ", zoomShift " << zoomShift;
+    }
+}
+
+TEST(DrawingTest, BlitRleRunSse4_1)
+{
+    if (!SSE41Available())
+    {
+        GTEST_SKIP() << "SSE 4.1 is not available";
+    }
+    CompareWithScalar(BlitRleRunSse4_1);
+}
+
+TEST(DrawingTest, BlitRleRunAvx2)
+{
+    if (!AVX2Available())
+    {
+        GTEST_SKIP() << "AVX2 is not available";
+    }
+    CompareWithScalar(BlitRleRunAvx2);
+}
+
+// Creates an RLE sprite with random runs, including transparent pixels within the runs.
+static std::vector<uint8_t> CreateRleSprite(std::mt19937& random, int32_t width, int32_t height)
+{
+    std::vector<uint8_t> data(height * 2);
+    for (int32_t y = 0; y < height; y++)
+    {
+        const auto lineOffset = data.size();
+        data[y * 2] = lineOffset & 0xFF;
+        data[y * 2 + 1] = (lineOffset >> 8) & 0xFF;
+
+        size_t lastRun = data.size();
+        data.push_back(0);
+        data.push_back(0);
+        for (int32_t x = random() % 8; x < width; x += random() % 8)
+        {
+            const auto numPixels = std::min<int32_t>(1 + random() % 40, width - x);
+            lastRun = data.size();
+            data.push_back(static_cast<uint8_t>(numPixels));
+            data.push_back(static_cast<uint8_t>(x));
+            for (int32_t i = 0; i < numPixels; i++)
+            {
+                data.push_back((random() % 4) == 0 ? 0 : static_cast<uint8_t>(random()));
+            }
+            x += numPixels;
+        }
+        data[lastRun] |= 0x80;
+    }
+    return data;
+}
+
+TEST(DrawingTest, MinifiedSpriteCache)
+{
+    std::mt19937 random(0);
+    for (int32_t i = 0; i < 1000; i++)
+    {
+        const int32_t width = 32 + random() % 200;
+        const int32_t height = 32 + random() % 100;
+        auto data = CreateRleSprite(random, width, height);
+        G1Element g1;
+        g1.offset = data.data();
+        g1.width = width;
+        g1.height = height;
+        g1.flags = G1_FLAG_RLE_COMPRESSION;
+
+        const int32_t zoomShift = 1 + random() % 3;
+        const int32_t zoom = 1 << zoomShift;
+        const int32_t srcX = random() % width;
+        const int32_t srcY = static_cast<int32_t>(random() % height) - (zoom - 1);
+        const int32_t drawWidth = 1 + random() % (width - srcX);
+        const int32_t drawHeight = 1 + random() % (height - std::max(srcY, 0));
+
+        DrawPixelInfo dpi;
+        dpi.width = (width + zoom) & ~(zoom - 1);
+        dpi.height = (height + 2 * zoom) & ~(zoom - 1);
+        dpi.zoom_level = ZoomLevel{ static_cast<int8_t>(zoomShift) };
+        std::vector<uint8_t> expected((dpi.width >> zoomShift) * (dpi.height >> zoomShift));
+        for (auto& pixel : expected)
+        {
+            pixel = static_cast<uint8_t>(random());
+        }
+        auto actual = expected;
+
+        // Temporary images are never cached, the other image is drawn twice to also use the cached variant
+        const auto& paletteMap = PaletteMap::GetDefault();
+        GfxRleSpriteToBuffer(
+            dpi, DrawSpriteArgs(ImageId(SPR_TEMP), paletteMap, g1, srcX, srcY, drawWidth, drawHeight, expected.data()));
+        for (int32_t j = 0; j < 2; j++)
+        {
+            GfxRleSpriteToBuffer(
+                dpi, DrawSpriteArgs(ImageId(i), paletteMap, g1, srcX, srcY, drawWidth, drawHeight, actual.data()));
+        }
+        ASSERT_EQ(expected, actual) << "zoomShift " << zoomShift << ", srcX " << srcX << ", srcY " << srcY;
+    }
+}
+
+TEST(DrawingTest, MinifiedSpriteCacheInvalidate)
+{
+    constexpr ImageIndex index = 1000;
+    std::mt19937 random(0);
+    std::vector<uint8_t> data;
+    // Keep the pixels at the same address when they are replaced, like a freed and reallocated image can be
+    data.reserve(1024 * 1024);
+    G1Element g1;
+    g1.width = 64;
+    g1.height = 64;
+    g1.flags = G1_FLAG_RLE_COMPRESSION;
+
+    DrawPixelInfo dpi;
+    dpi.width = 64;
+    dpi.height = 64;
+    dpi.zoom_level = ZoomLevel{ 1 };
+    const auto& paletteMap = PaletteMap::GetDefault();
+    for (int32_t i = 0; i < 2; i++)
+    {
+        auto sprite = CreateRleSprite(random, g1.width, g1.height);
+        data.assign(sprite.begin(), sprite.end());
+        g1.offset = data.data();
+        MinifiedSpriteCache::Invalidate(index, 1);
+
+        std::vector<uint8_t> expected(32 * 32);
+        auto actual = expected;
+        GfxRleSpriteToBuffer(
+            dpi, DrawSpriteArgs(ImageId(SPR_TEMP), paletteMap, g1, 0, 0, g1.width, g1.height, expected.data()));
+        GfxRleSpriteToBuffer(dpi, DrawSpriteArgs(ImageId(index), paletteMap, g1, 0, 0, g1.width, g1.height, actual.data()));
+        ASSERT_EQ(expected, actual);
+    }
+}
@@ -0,0 +1,92 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef ENABLE_SCRIPTING
+
+#    include "TestData.h"
+
+#    include <gtest/gtest.h>
+#    include <memory>
+#    include <openrct2/Context.h>
+#    include <openrct2/Game.h>
+#    include <openrct2/OpenRCT2.h>
+#    include <openrct2/scripting/ScriptEngine.h>
+#    include <string>
+
+using namespace OpenRCT2;
+
+class ScriptingTest : public testing::Test
+{
+protected:
+    static void SetUpTestCase()
+    {
+        std::string parkPath = TestData::GetParkPath("tile-element-tests.sv6");
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+        _context = CreateContext();
+        bool initialised = _context->Initialise();
+        ASSERT_TRUE(initialised);
+
+        GetContext()->LoadParkFromFile(parkPath);
+        GameLoadInit();
+    }
+
+    static void TearDownTestCase()
+    {
+        _context.reset();
+    }
+
+    // Evaluates the script and returns its result as a string, or the error it threw.
+    static std::string Eval(const char* code)
+    {
+        auto* ctx = _context->GetScriptEngine().GetContext();
+        std::string result;
+        if (duk_peval_string(ctx, code) != 0)
+        {
+            result = "error: ";
+        }
+        result += duk_safe_to_string(ctx, -1);
+        duk_pop(ctx);
+        return result;
+    }
+
+private:
+    static std::shared_ptr<IContext> _context;
+};
+
+std::shared_ptr<IContext> ScriptingTest::_context;
+
+TEST_F(ScriptingTest, TileElementsIndexed)
+{
+    EXPECT_EQ(
+        Eval("var tile = map.getTile(19, 18); tile.elements.length === tile.numElements && tile.numElements > 1"), "true");
+    EXPECT_EQ(Eval("typeof map.getTile(19, 18).elements[0]"), "object");
+    EXPECT_EQ(Eval("map.getTile(19, 18).elements[0].type"), "surface");
+    EXPECT_EQ(Eval("var tile = map.getTile(19, 18); tile.elements[1].type === tile.getElement(1).type"), "true");
+    EXPECT_EQ(Eval("typeof map.getTile(19, 18).elements[1000]"), "undefined");
+}
+
+TEST_F(ScriptingTest, TileElementsIterated)
+{
+    EXPECT_EQ(
+        Eval("var tile = map.getTile(19, 18);"
+             "var expected = [];"
+             "for (var i = 0; i < tile.numElements; i++) expected.push(tile.getElement(i).type);"
+             "tile.elements.map(function (e) { return e.type; }).join() === expected.join()"),
+        "true");
+    EXPECT_EQ(
+        Eval("var types = [];"
+             "map.getTile(19, 18).elements.forEach(function (e) { types.push(e.type); });"
+             "types[0]"),
+        "surface");
+    EXPECT_EQ(
+        Eval("map.getTile(19, 18).elements.filter(function (e) { return e.type === 'footpath'; }).length > 0"), "true");
+}
+
+#endif